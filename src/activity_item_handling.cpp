@@ -10,6 +10,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -145,6 +146,7 @@ static const zone_type_id zone_type_LOOT_CORPSE( "LOOT_CORPSE" );
 static const zone_type_id zone_type_LOOT_CUSTOM( "LOOT_CUSTOM" );
 static const zone_type_id zone_type_LOOT_IGNORE( "LOOT_IGNORE" );
 static const zone_type_id zone_type_LOOT_IGNORE_FAVORITES( "LOOT_IGNORE_FAVORITES" );
+static const zone_type_id zone_type_LOOT_ITEM_GROUP( "LOOT_ITEM_GROUP" );
 static const zone_type_id zone_type_LOOT_UNSORTED( "LOOT_UNSORTED" );
 static const zone_type_id zone_type_LOOT_WOOD( "LOOT_WOOD" );
 static const zone_type_id zone_type_MINING( "MINING" );
@@ -1988,6 +1990,139 @@ static bool chop_plank_activity( Character &you, const tripoint_bub_ms &src_loc
     return false;
 }
 
+namespace
+{
+
+/**
+ * Destination plan for sorting the items of one loot source tile.
+ *
+ * Zone queries that don't depend on the individual item are resolved once per
+ * zone type and destination tiles are ordered by distance from the source.
+ * Free volume and item count of destination tiles are tracked as items are
+ * moved instead of being summed up from the tile contents for every item.
+ */
+class move_loot_plan
+{
+    public:
+        move_loot_plan( const zone_manager &mgr, const tripoint_abs_ms &abspos,
+                        const tripoint_abs_ms &src, const faction_id &fac ) :
+            mgr( mgr ), abspos( abspos ), src( src ), fac( fac ) {
+            ignore_favorites = mgr.has( zone_type_LOOT_IGNORE_FAVORITES, src, fac );
+            unload_near = mgr.has_near( zone_type_UNLOAD_ALL, abspos, 1, fac );
+            strip_corpses_near = mgr.has_near( zone_type_STRIP_CORPSES, abspos, 1, fac );
+        }
+
+        bool ignore_favorites = false;
+        bool unload_near = false;
+        bool strip_corpses_near = false;
+
+        /** Whether the item is already sitting in a zone of the type it would be sorted into. */
+        bool already_sorted( const zone_type_id &id, const item &it ) {
+            if( id == zone_type_LOOT_CUSTOM ) {
+                return mgr.custom_loot_has( src, &it, zone_type_LOOT_CUSTOM, fac );
+            }
+            return destinations_for( id ).contains_source;
+        }
+
+        /** Destination tiles for the item, nearest to the source first. */
+        const std::vector<tripoint_abs_ms> &destinations( const zone_type_id &id, const item &it ) {
+            if( id == zone_type_LOOT_CUSTOM || id == zone_type_LOOT_ITEM_GROUP ) {
+                // these zones filter on the item itself
+                item_destinations = sorted( mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE, &it, fac ) );
+                return item_destinations;
+            }
+            return destinations_for( id ).tiles;
+        }
+
+        /** Whether @p it can be dropped on @p dest. */
+        bool fits( const tripoint_abs_ms &dest, const item &it ) {
+            tile_capacity &cap = capacity( dest );
+            if( !cap.accessible ) {
+                return false;
+            }
+            if( !cap.has_room_for( it ) && !cap.exact ) {
+                // the running estimate may be stale if items stacked on drop, so recount
+                cap = measure( dest );
+            }
+            return cap.has_room_for( it );
+        }
+
+        /** Account for @p it having been dropped on @p dest. */
+        void moved_to( const tripoint_abs_ms &dest, const item &it ) {
+            tile_capacity &cap = capacity( dest );
+            cap.free_space -= it.volume();
+            cap.item_count++;
+            cap.exact = false;
+        }
+
+    private:
+        struct destination_group {
+            std::vector<tripoint_abs_ms> tiles;
+            bool contains_source = false;
+        };
+
+        struct tile_capacity {
+            units::volume free_space = 0_ml;
+            int item_count = 0;
+            bool accessible = false;
+            bool exact = true;
+
+            bool has_room_for( const item &it ) const {
+                return item_count < MAX_ITEM_IN_SQUARE && free_space >= it.volume();
+            }
+        };
+
+        const destination_group &destinations_for( const zone_type_id &id ) {
+            auto iter = groups.find( id );
+            if( iter == groups.end() ) {
+                destination_group group;
+                group.tiles = sorted( mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE, nullptr, fac ) );
+                group.contains_source = mgr.has( id, src, fac );
+                iter = groups.emplace( id, std::move( group ) ).first;
+            }
+            return iter->second;
+        }
+
+        std::vector<tripoint_abs_ms> sorted( const std::unordered_set<tripoint_abs_ms> &tiles ) const {
+            return get_sorted_tiles_by_distance( src, tiles );
+        }
+
+        tile_capacity &capacity( const tripoint_abs_ms &dest ) {
+            auto iter = capacities.find( dest );
+            if( iter == capacities.end() ) {
+                iter = capacities.emplace( dest, measure( dest ) ).first;
+            }
+            return iter->second;
+        }
+
+        static tile_capacity measure( const tripoint_abs_ms &dest ) {
+            map &here = get_map();
+            const tripoint_bub_ms dest_loc = here.bub_from_abs( dest );
+            tile_capacity cap;
+            // skip tiles with inaccessible furniture, like filled charcoal kiln
+            cap.accessible = here.can_put_items_ter_furn( dest_loc );
+            //Check destination for cargo part
+            if( const std::optional<vpart_reference> ovp = here.veh_at( dest_loc ).cargo() ) {
+                cap.free_space = ovp->items().free_volume();
+            } else {
+                cap.free_space = here.free_volume( dest_loc );
+            }
+            cap.item_count = static_cast<int>( here.i_at( dest_loc ).size() );
+            return cap;
+        }
+
+        const zone_manager &mgr;
+        const tripoint_abs_ms abspos;
+        const tripoint_abs_ms src;
+        const faction_id fac;
+
+        std::unordered_map<zone_type_id, destination_group> groups;
+        std::unordered_map<tripoint_abs_ms, tile_capacity> capacities;
+        std::vector<tripoint_abs_ms> item_destinations;
+};
+
+} // namespace
+
 void activity_on_turn_move_loot( player_activity &act, Character &you )
 {
     enum activity_stage : int {
@@ -2193,6 +2328,8 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             unload_always |= options.unload_always();
         }
 
+        move_loot_plan plan( mgr, abspos, src, _fac_id( you ) );
+
         //Skip items that have already been processed
         for( auto it = items.begin() + num_processed; it < items.end(); ++it ) {
             ++num_processed;
@@ -2209,7 +2346,7 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             }
 
             // skip favorite items in ignore favorite zones
-            if( thisitem.is_favorite && mgr.has( zone_type_LOOT_IGNORE_FAVORITES, src, _fac_id( you ) ) ) {
+            if( thisitem.is_favorite && plan.ignore_favorites ) {
                 continue;
             }
 
@@ -2221,17 +2358,11 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             // checks whether the item is already on correct loot zone or not
             // if it is, we can skip such item, if not we move the item to correct pile
             // think empty bag on food pile, after you ate the content
-            if( id != zone_type_LOOT_CUSTOM && mgr.has( id, src, _fac_id( you ) ) ) {
+            if( plan.already_sorted( id, thisitem ) ) {
                 continue;
             }
 
-            if( id == zone_type_LOOT_CUSTOM &&
-                mgr.custom_loot_has( src, &thisitem, zone_type_LOOT_CUSTOM, _fac_id( you ) ) ) {
-                continue;
-            }
-
-            const std::unordered_set<tripoint_abs_ms> dest_set =
-                mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE, &thisitem, _fac_id( you ) );
+            const std::vector<tripoint_abs_ms> &dest_set = plan.destinations( id, thisitem );
 
             // if this item isn't going anywhere and its not sealed
             // check if it is in a unload zone or a strip corpse zone
@@ -2239,8 +2370,7 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             bool move_and_reset = false;
             bool moved_something = false;
 
-            if( mgr.has_near( zone_type_UNLOAD_ALL, abspos, 1, _fac_id( you ) ) ||
-                ( mgr.has_near( zone_type_STRIP_CORPSES, abspos, 1, _fac_id( you ) ) && it->first->is_corpse() ) ) {
+            if( plan.unload_near || ( plan.strip_corpses_near && it->first->is_corpse() ) ) {
                 if( dest_set.empty() || unload_always ) {
                     if( you.rate_action_unload( *it->first ) == hint_rating::good &&
                         !it->first->any_pockets_sealed() ) {
@@ -2336,25 +2466,10 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             }
 
             for( const tripoint_abs_ms &dest : dest_set ) {
-                const tripoint_bub_ms dest_loc = here.bub_from_abs( dest );
-                units::volume free_space;
-
-                //Check destination for cargo part
-                if( const std::optional<vpart_reference> ovp = here.veh_at( dest_loc ).cargo() ) {
-                    free_space = ovp->items().free_volume();
-                } else {
-                    free_space = here.free_volume( dest_loc );
-                }
-
-                // skip tiles with inaccessible furniture, like filled charcoal kiln
-                if( !here.can_put_items_ter_furn( dest_loc ) ||
-                    static_cast<int>( here.i_at( dest_loc ).size() ) >= MAX_ITEM_IN_SQUARE ) {
-                    continue;
-                }
-
                 // check free space at destination
-                if( free_space >= thisitem.volume() ) {
-                    move_item( you, thisitem, thisitem.count(), src_loc, dest_loc, vpr_src );
+                if( plan.fits( dest, thisitem ) ) {
+                    plan.moved_to( dest, thisitem );
+                    move_item( you, thisitem, thisitem.count(), src_loc, here.bub_from_abs( dest ), vpr_src );
 
                     // moved item away from source so decrement
                     if( num_processed > 0 ) {
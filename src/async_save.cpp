@@ -0,0 +1,258 @@
+#include "async_save.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
+#include "gzip_stream.h"
+#include "ofstream_wrapper.h"
+#include "string_formatter.h"
+#include "translations.h"
+
+namespace async_save
+{
+namespace
+{
+
+struct job {
+    fs::path path;
+    std::string contents;
+    std::string fail_message;
+    bool remove = false;
+    bool compress = false;
+    // marks the end of a batch, which is then reported by finished()
+    bool end_of_batch = false;
+};
+
+struct failure {
+    std::string fail_message;
+    std::string path;
+    std::string what;
+};
+
+std::optional<failure> perform( const job &j )
+{
+    try {
+        if( j.remove ) {
+            fs::remove( j.path );
+        } else {
+            // ofstream_wrapper writes to a temporary file and renames it over the target
+            ofstream_wrapper fout( j.path, std::ios::binary );
+            if( j.compress ) {
+                gzip_ostream gzout( fout.stream() );
+                gzout.write( j.contents.data(), j.contents.size() );
+                gzout.finish();
+            } else {
+                fout.stream().write( j.contents.data(), j.contents.size() );
+            }
+            fout.close();
+        }
+    } catch( const std::exception &err ) {
+        return failure{ j.fail_message, j.path.generic_u8string(), err.what() };
+    }
+    return std::nullopt;
+}
+
+class writer
+{
+    public:
+        ~writer() {
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                stopping = true;
+            }
+            wake.notify_all();
+            // the worker drains the queue before it exits
+            if( worker.joinable() ) {
+                worker.join();
+            }
+        }
+
+        void push( job &&j ) {
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                if( !j.end_of_batch ) {
+                    j.path = j.path.lexically_normal();
+                    ++pending[j.path];
+                    ++num_pending;
+                }
+                queue.push_back( std::move( j ) );
+                if( !worker.joinable() ) {
+                    worker = std::thread( [this]() {
+                        run();
+                    } );
+                }
+            }
+            wake.notify_one();
+        }
+
+        void wait_for( const fs::path &path ) {
+            if( num_pending == 0 ) {
+                return;
+            }
+            const fs::path normal = path.lexically_normal();
+            std::unique_lock<std::mutex> lock( mutex );
+            done.wait( lock, [&]() {
+                return pending.count( normal ) == 0;
+            } );
+        }
+
+        void wait_all() {
+            std::unique_lock<std::mutex> lock( mutex );
+            done.wait( lock, [this]() {
+                return queue.empty() && !busy;
+            } );
+        }
+
+        std::vector<std::vector<failure>> take_finished() {
+            std::lock_guard<std::mutex> lock( mutex );
+            return std::exchange( finished_batches, {} );
+        }
+
+    private:
+        void run() {
+            std::unique_lock<std::mutex> lock( mutex );
+            while( true ) {
+                wake.wait( lock, [this]() {
+                    return stopping || !queue.empty();
+                } );
+                if( queue.empty() ) {
+                    return;
+                }
+                const job j = std::move( queue.front() );
+                queue.pop_front();
+                busy = true;
+                lock.unlock();
+                std::optional<failure> failed = j.end_of_batch ? std::nullopt : perform( j );
+                lock.lock();
+                busy = false;
+                if( failed ) {
+                    batch_failures.push_back( std::move( *failed ) );
+                }
+                if( j.end_of_batch ) {
+                    finished_batches.push_back( std::exchange( batch_failures, {} ) );
+                } else {
+                    auto it = pending.find( j.path );
+                    if( --it->second == 0 ) {
+                        pending.erase( it );
+                    }
+                    --num_pending;
+                }
+                done.notify_all();
+            }
+        }
+
+        std::mutex mutex;
+        // signals the worker that a job was queued or that it should stop
+        std::condition_variable wake;
+        // signals waiting readers that a job finished
+        std::condition_variable done;
+        std::deque<job> queue;
+        // number of queued or running writes per target path
+        std::map<fs::path, int> pending;
+        // lets readers skip the lock when nothing is queued at all
+        std::atomic<int> num_pending{ 0 };
+        bool busy = false;
+        bool stopping = false;
+        std::vector<failure> batch_failures;
+        std::vector<std::vector<failure>> finished_batches;
+        std::thread worker;
+};
+
+writer &get_writer()
+{
+    static writer instance;
+    return instance;
+}
+
+int batch_depth = 0;
+
+} // namespace
+
+batch::batch()
+{
+    ++batch_depth;
+}
+
+batch::~batch()
+{
+    if( --batch_depth == 0 ) {
+        job end;
+        end.end_of_batch = true;
+        get_writer().push( std::move( end ) );
+    }
+}
+
+bool deferring()
+{
+#if defined(EMSCRIPTEN)
+    // no threads to write on
+    return false;
+#else
+    return batch_depth > 0;
+#endif
+}
+
+void write( const fs::path &path, std::string &&contents, const std::string &fail_message,
+            const bool compress )
+{
+    job j;
+    j.path = path;
+    j.contents = std::move( contents );
+    j.fail_message = fail_message;
+    j.compress = compress;
+    get_writer().push( std::move( j ) );
+}
+
+void remove( const fs::path &path )
+{
+    if( !deferring() ) {
+        wait_for( path );
+        fs::remove( path );
+        return;
+    }
+    job j;
+    j.path = path;
+    j.remove = true;
+    get_writer().push( std::move( j ) );
+}
+
+void wait_for( const fs::path &path )
+{
+    get_writer().wait_for( path );
+}
+
+void wait_all()
+{
+    get_writer().wait_all();
+}
+
+std::vector<report> finished()
+{
+    std::vector<report> reports;
+    for( const std::vector<failure> &failures : get_writer().take_finished() ) {
+        report &r = reports.emplace_back();
+        for( const failure &f : failures ) {
+            if( f.fail_message.empty() ) {
+                r.errors.push_back( string_format( _( "Failed to write \"%1$s\": %2$s" ),
+                                                   f.path, f.what ) );
+            } else {
+                r.errors.push_back( string_format( _( "Failed to write %1$s to \"%2$s\": %3$s" ),
+                                                   f.fail_message, f.path, f.what ) );
+            }
+        }
+    }
+    return reports;
+}
+
+} // namespace async_save
@@ -0,0 +1,67 @@
+#pragma once
+#ifndef CATA_SRC_ASYNC_SAVE_H
+#define CATA_SRC_ASYNC_SAVE_H
+
+#include <string>
+#include <vector>
+
+#include "filesystem.h"
+
+/**
+ * Writing save files on a background thread.
+ *
+ * While a @ref async_save::batch is alive, @ref write_to_file serializes into memory on the
+ * calling thread and hands the result to a worker thread, which writes it to a temporary
+ * file and renames that over the target. The game state is therefore captured when the
+ * save is made, but the game does not wait for the disk.
+ *
+ * Reading or overwriting a file that still has a write queued waits for that write first,
+ * so callers never observe a stale or half written file.
+ */
+namespace async_save
+{
+
+/** Defers file writes made on this thread to the worker for as long as it is alive. */
+class batch
+{
+    public:
+        batch();
+        ~batch();
+        batch( const batch & ) = delete;
+        batch &operator=( const batch & ) = delete;
+};
+
+struct report {
+    /** Translated descriptions of the writes of the batch that failed. */
+    std::vector<std::string> errors;
+};
+
+/** Whether writes are currently deferred to the worker thread. */
+bool deferring();
+
+/**
+ * Queue @p contents to be written to @p path.
+ * @param fail_message Describes the file in the error report if writing fails, may be empty.
+ * @param compress Whether the worker gzip compresses @p contents while writing them.
+ */
+void write( const fs::path &path, std::string &&contents, const std::string &fail_message,
+            bool compress = false );
+
+/**
+ * Remove @p path. When deferring, the removal is queued behind any pending writes
+ * instead. Throws like `fs::remove` when done immediately.
+ */
+void remove( const fs::path &path );
+
+/** Block until no write to @p path is queued or in progress. */
+void wait_for( const fs::path &path );
+
+/** Block until every queued write has finished. */
+void wait_all();
+
+/** The results of the batches that finished since the last call, oldest first. */
+std::vector<report> finished();
+
+} // namespace async_save
+
+#endif // CATA_SRC_ASYNC_SAVE_H
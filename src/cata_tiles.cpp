@@ -7,6 +7,7 @@
 #include <cmath>
 #include <cstdint>
 #include <iterator>
+#include <numeric>
 #include <optional>
 #include <set>
 #include <stdexcept>
@@ -202,7 +203,8 @@ cata_tiles::cata_tiles( const SDL_Renderer_Ptr &renderer, const GeometryRenderer
     renderer( renderer ),
     geometry( geometry ),
     cache( cache ),
-    minimap( renderer, geometry )
+    minimap( renderer, geometry ),
+    map_sprites( renderer )
 {
     cata_assert( renderer );
 
@@ -327,6 +329,10 @@ tile_type &tileset::create_tile_type( const std::string &id, tile_type &&new_til
 void cata_tiles::load_tileset( const std::string &tileset_id, const bool precheck,
                                const bool force, const bool pump_events )
 {
+    // resolved tiles point into the tileset and depend on the loaded game data,
+    // both of which may be replaced here
+    clear_looks_like_cache();
+    invalidate_map_layer();
     if( tileset_ptr && tileset_ptr->get_tileset_id() == tileset_id && !force ) {
         return;
     }
@@ -615,6 +621,7 @@ void cata_tiles::set_draw_scale( int scale )
     max_tile_extent.p_max.x = divide_round_down( max_tile_extent.p_max.x * mult, div );
     max_tile_extent.p_max.y = divide_round_down( max_tile_extent.p_max.y * mult, div );
     zlevel_height = tileset_ptr->get_zlevel_height();
+    invalidate_map_layer();
 }
 
 void tileset_cache::loader::load( const std::string &tileset_id, const bool precheck,
@@ -1689,11 +1696,17 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         do_draw_shadow = true;
     }
 
+    // The layers are recorded instead of drawn, so that only the parts of the
+    // retained map layer that look different from the last frame are redrawn
+    map_layer_cur.clear();
+    recording_map_layer = true;
+
     if( max_draw_depth <= 0 ) {
         // Legacy draw mode
         for( int row = min_row; row < max_row; row ++ ) {
             for( auto f : drawing_layers_legacy ) {
                 for( tile_render_info &p : here.draw_points_cache[center.z][row] ) {
+                    map_layer_cell = p.com.pos;
                     if( const tile_render_info::vision_effect * const
                         var = std::get_if<tile_render_info::vision_effect>( &p.var ) ) {
                         if( f == &cata_tiles::draw_terrain ) {
@@ -1724,6 +1737,7 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
                 for( auto f : drawing_layers ) {
                     // For each tile
                     for( tile_render_info &p : here.draw_points_cache[cur_zlevel][row] ) {
+                        map_layer_cell = p.com.pos;
                         if( const tile_render_info::vision_effect * const
                             var = std::get_if<tile_render_info::vision_effect>( &p.var ) ) {
                             if( f == &cata_tiles::draw_terrain ) {
@@ -1764,6 +1778,9 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         }
     }
 
+    recording_map_layer = false;
+    flush_map_layer( SDL_Rect{ dest.x, dest.y, width, height } );
+
     // display number of monsters to spawn in mapgen preview
     for( int row = top_any_tile_range.p_min.y; row < top_any_tile_range.p_max.y; row ++ ) {
         for( const tile_render_info &p : here.draw_points_cache[center.z][row] ) {
@@ -2267,13 +2284,47 @@ cata_tiles::find_tile_looks_like_by_string_id( const std::string_view id, TILE_C
         return std::nullopt;
     }
     const T &obj = s_id.obj();
-    return find_tile_looks_like( obj.looks_like, category, "", looks_like_jumps_limit - 1 );
+    return resolve_tile_looks_like( obj.looks_like, category, "", looks_like_jumps_limit - 1 );
 }
 
 std::optional<tile_lookup_res>
 cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
-                                  const std::string &variant,
-                                  const int looks_like_jumps_limit ) const
+                                  const std::string &variant ) const
+{
+    const season_type season = season_of_year( calendar::turn );
+    if( season != looks_like_cache_season ) {
+        clear_looks_like_cache();
+        looks_like_cache_season = season;
+    }
+    // The draw loop asks for the same few hundred ids every frame, so remember
+    // where each ( id, variant ) pair ended up after following variants, seasons
+    // and looks_like chains. Lookups on a hit do not allocate.
+    auto &by_id = looks_like_cache[static_cast<size_t>( category )];
+    auto id_it = by_id.find( id );
+    if( id_it != by_id.end() ) {
+        const auto var_it = id_it->second.find( variant );
+        if( var_it != id_it->second.end() ) {
+            return var_it->second;
+        }
+    } else {
+        id_it = by_id.emplace( id, looks_like_variant_cache() ).first;
+    }
+    std::optional<tile_lookup_res> res = resolve_tile_looks_like( id, category, variant, 10 );
+    id_it->second.emplace( variant, res );
+    return res;
+}
+
+void cata_tiles::clear_looks_like_cache() const
+{
+    for( auto &by_id : looks_like_cache ) {
+        by_id.clear();
+    }
+}
+
+std::optional<tile_lookup_res>
+cata_tiles::resolve_tile_looks_like( const std::string &id, TILE_CATEGORY category,
+                                     const std::string &variant,
+                                     const int looks_like_jumps_limit ) const
 {
     if( id.empty() || looks_like_jumps_limit <= 0 ) {
         return std::nullopt;
@@ -2335,7 +2386,7 @@ cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
             int jump_limit = looks_like_jumps_limit;
             for( const std::string &looks_like : type_tmp.obj().looks_like ) {
 
-                ret = find_tile_looks_like( looks_like, category, "", jump_limit - 1 );
+                ret = resolve_tile_looks_like( looks_like, category, "", jump_limit - 1 );
                 if( ret.has_value() ) {
                     return ret;
                 }
@@ -2360,13 +2411,14 @@ cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
             if( looks_like.empty() ) {
                 return std::nullopt;
             }
-            if( auto ret = find_tile_looks_like( "vp_" + looks_like, category, variant, lljl ) ) {
+            if( auto ret = resolve_tile_looks_like( "vp_" + looks_like, category, variant, lljl ) ) {
                 return ret;
             }
-            if( auto ret = find_tile_looks_like( looks_like, category, variant, lljl ) ) {
+            if( auto ret = resolve_tile_looks_like( looks_like, category, variant, lljl ) ) {
                 return ret;
             }
-            if( auto ret = find_tile_looks_like( looks_like, TILE_CATEGORY::FURNITURE, variant, lljl ) ) {
+            if( auto ret = resolve_tile_looks_like( looks_like, TILE_CATEGORY::FURNITURE, variant,
+                                                    lljl ) ) {
                 return ret;
             }
             return std::nullopt;
@@ -2375,15 +2427,15 @@ cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
         case TILE_CATEGORY::ITEM: {
             if( !item::type_is_defined( itype_id( id ) ) ) {
                 if( string_starts_with( id, "corpse_" ) ) {
-                    return find_tile_looks_like(
+                    return resolve_tile_looks_like(
                                "corpse", category, "", looks_like_jumps_limit - 1
                            );
                 }
                 return std::nullopt;
             }
             const itype *new_it = item::find_type( itype_id( id ) );
-            return find_tile_looks_like( new_it->looks_like.str(), category, "",
-                                         looks_like_jumps_limit - 1 );
+            return resolve_tile_looks_like( new_it->looks_like.str(), category, "",
+                                            looks_like_jumps_limit - 1 );
         }
 
         default:
@@ -2989,16 +3041,14 @@ bool cata_tiles::draw_sprite_at(
     if( rotate_sprite ) {
         if( rota == -1 ) {
             // flip horizontally
-            ret = sprite_tex->render_copy_ex(
-                      renderer, &destination, 0, nullptr,
-                      static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL ) );
+            ret = render_sprite( *sprite_tex, destination, 0,
+                                 static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL ) );
         } else {
             switch( rota % 4 ) {
                 default:
                 case 0:
                     // unrotated (and 180, with just two sprites)
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                      SDL_FLIP_NONE );
+                    ret = render_sprite( *sprite_tex, destination, 0, SDL_FLIP_NONE );
                     break;
                 case 1:
                     // 90 degrees (and 270, with just two sprites)
@@ -3011,23 +3061,20 @@ bool cata_tiles::draw_sprite_at(
 #endif
                     if( !is_isometric() ) {
                         // never rotate isometric tiles
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, -90, nullptr,
-                                                          SDL_FLIP_NONE );
+                        ret = render_sprite( *sprite_tex, destination, -90, SDL_FLIP_NONE );
                     } else {
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                          SDL_FLIP_NONE );
+                        ret = render_sprite( *sprite_tex, destination, 0, SDL_FLIP_NONE );
                     }
                     break;
                 case 2:
                     // 180 degrees, implemented with flips instead of rotation
                     if( !is_isometric() ) {
                         // never flip isometric tiles vertically
-                        ret = sprite_tex->render_copy_ex(
-                                  renderer, &destination, 0, nullptr,
+                        ret = render_sprite(
+                                  *sprite_tex, destination, 0,
                                   static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL ) );
                     } else {
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                          SDL_FLIP_NONE );
+                        ret = render_sprite( *sprite_tex, destination, 0, SDL_FLIP_NONE );
                     }
                     break;
                 case 3:
@@ -3041,18 +3088,16 @@ bool cata_tiles::draw_sprite_at(
 #endif
                     if( !is_isometric() ) {
                         // never rotate isometric tiles
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 90, nullptr,
-                                                          SDL_FLIP_NONE );
+                        ret = render_sprite( *sprite_tex, destination, 90, SDL_FLIP_NONE );
                     } else {
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                          SDL_FLIP_NONE );
+                        ret = render_sprite( *sprite_tex, destination, 0, SDL_FLIP_NONE );
                     }
                     break;
             }
         }
     } else {
         // don't rotate, same as case 0 above
-        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr, SDL_FLIP_NONE );
+        ret = render_sprite( *sprite_tex, destination, 0, SDL_FLIP_NONE );
     }
 
     printErrorIf( ret != 0, "SDL_RenderCopyEx() failed" );
@@ -3076,6 +3121,325 @@ bool cata_tiles::draw_tile_at(
     return true;
 }
 
+static bool rects_overlap( const SDL_Rect &a, const SDL_Rect &b )
+{
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static SDL_Rect rect_union( const SDL_Rect &a, const SDL_Rect &b )
+{
+    const int x = std::min( a.x, b.x );
+    const int y = std::min( a.y, b.y );
+    return SDL_Rect{ x, y, std::max( a.x + a.w, b.x + b.w ) - x,
+                     std::max( a.y + a.h, b.y + b.h ) - y };
+}
+
+SDL_Rect map_draw_op::bounds() const
+{
+    if( angle % 180 == 0 ) {
+        return dst;
+    }
+    // rotated around the centre of dst; pad a pixel for the rounding of odd sizes
+    return SDL_Rect{ dst.x + divide_round_down( dst.w - dst.h, 2 ) - 1,
+                     dst.y + divide_round_down( dst.h - dst.w, 2 ) - 1,
+                     dst.h + 2, dst.w + 2 };
+}
+
+bool map_draw_op::same_output( const map_draw_op &rhs ) const
+{
+    return tex == rhs.tex && dst.x == rhs.dst.x && dst.y == rhs.dst.y && dst.w == rhs.dst.w &&
+           dst.h == rhs.dst.h && angle == rhs.angle && flip == rhs.flip &&
+           color.r == rhs.color.r && color.g == rhs.color.g && color.b == rhs.color.b &&
+           color.a == rhs.color.a && blend == rhs.blend;
+}
+
+void map_layer_frame::clear()
+{
+    ops.clear();
+    by_cell.clear();
+}
+
+void map_layer_frame::index()
+{
+    by_cell.resize( ops.size() );
+    std::iota( by_cell.begin(), by_cell.end(), 0 );
+    std::stable_sort( by_cell.begin(), by_cell.end(), [this]( const size_t l, const size_t r ) {
+        return ops[l].cell < ops[r].cell;
+    } );
+}
+
+std::optional<std::vector<SDL_Rect>> map_layer_damage(
+    const map_layer_frame &prev, const map_layer_frame &cur, const size_t max_rects,
+    const int64_t max_area )
+{
+    std::vector<SDL_Rect> damage;
+    const auto add_damage = [&damage]( SDL_Rect area ) {
+        if( area.w <= 0 || area.h <= 0 ) {
+            return;
+        }
+        // absorb every rectangle the new one touches until none is left
+        for( bool merged = true; merged; ) {
+            merged = false;
+            const SDL_Rect padded = { area.x - 1, area.y - 1, area.w + 2, area.h + 2 };
+            for( SDL_Rect &other : damage ) {
+                if( rects_overlap( padded, other ) ) {
+                    area = rect_union( area, other );
+                    other = damage.back();
+                    damage.pop_back();
+                    merged = true;
+                    break;
+                }
+            }
+        }
+        damage.push_back( area );
+    };
+    // bounds of the ops of one cell, [begin, end) into by_cell
+    const auto cell_bounds = []( const map_layer_frame & frame, size_t begin, const size_t end ) {
+        SDL_Rect area = frame.ops[frame.by_cell[begin]].bounds();
+        for( ++begin; begin < end; ++begin ) {
+            area = rect_union( area, frame.ops[frame.by_cell[begin]].bounds() );
+        }
+        return area;
+    };
+    const auto cell_end = []( const map_layer_frame & frame, size_t i, const tripoint & cell ) {
+        while( i < frame.by_cell.size() && frame.ops[frame.by_cell[i]].cell == cell ) {
+            ++i;
+        }
+        return i;
+    };
+
+    // walk both frames cell by cell, as both are sorted by cell
+    size_t i = 0;
+    size_t j = 0;
+    while( i < prev.by_cell.size() || j < cur.by_cell.size() ) {
+        const bool take_prev = j >= cur.by_cell.size() || ( i < prev.by_cell.size() &&
+                               !( cur.ops[cur.by_cell[j]].cell < prev.ops[prev.by_cell[i]].cell ) );
+        const tripoint cell = take_prev ? prev.ops[prev.by_cell[i]].cell :
+                              cur.ops[cur.by_cell[j]].cell;
+        const size_t i_end = cell_end( prev, i, cell );
+        const size_t j_end = cell_end( cur, j, cell );
+        bool same = i_end - i == j_end - j;
+        for( size_t k = 0; same && k < i_end - i; ++k ) {
+            same = prev.ops[prev.by_cell[i + k]].same_output( cur.ops[cur.by_cell[j + k]] );
+        }
+        if( !same ) {
+            if( i < i_end ) {
+                add_damage( cell_bounds( prev, i, i_end ) );
+            }
+            if( j < j_end ) {
+                add_damage( cell_bounds( cur, j, j_end ) );
+            }
+            if( damage.size() > max_rects ) {
+                return std::nullopt;
+            }
+        }
+        i = i_end;
+        j = j_end;
+    }
+
+    int64_t area = 0;
+    for( const SDL_Rect &r : damage ) {
+        area += static_cast<int64_t>( r.w ) * r.h;
+    }
+    if( area > max_area ) {
+        return std::nullopt;
+    }
+    return damage;
+}
+
+void sprite_batch::add( const texture &tex, const SDL_Rect &dst, const int angle,
+                        const SDL_RendererFlip flip )
+{
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    SDL_Texture *const sdl_tex = tex.sdl_texture_ptr.get();
+    if( sdl_tex != current ) {
+        flush();
+        current = sdl_tex;
+        int w = 0;
+        int h = 0;
+        printErrorIf( SDL_QueryTexture( sdl_tex, nullptr, nullptr, &w, &h ) != 0,
+                      "SDL_QueryTexture failed" );
+        current_size = point( w, h );
+    }
+    if( current_size.x <= 0 || current_size.y <= 0 ) {
+        printErrorIf( tex.render_copy_ex( renderer, &dst, angle, nullptr, flip ) != 0,
+                      "SDL_RenderCopyEx() failed" );
+        return;
+    }
+    const SDL_Rect &src = tex.srcrect;
+    const float u0 = static_cast<float>( src.x ) / current_size.x;
+    const float v0 = static_cast<float>( src.y ) / current_size.y;
+    const float u1 = static_cast<float>( src.x + src.w ) / current_size.x;
+    const float v1 = static_cast<float>( src.y + src.h ) / current_size.y;
+    // clockwise from the top left corner of the destination
+    std::array<SDL_FPoint, 4> uv = {{ { u0, v0 }, { u1, v0 }, { u1, v1 }, { u0, v1 } }};
+    if( ( flip & SDL_FLIP_HORIZONTAL ) != 0 ) {
+        std::swap( uv[0], uv[1] );
+        std::swap( uv[2], uv[3] );
+    }
+    if( ( flip & SDL_FLIP_VERTICAL ) != 0 ) {
+        std::swap( uv[0], uv[3] );
+        std::swap( uv[1], uv[2] );
+    }
+    // SDL_RenderCopyEx flips first, then rotates clockwise around the centre of dst
+    const float half_w = dst.w / 2.0f;
+    const float half_h = dst.h / 2.0f;
+    const SDL_FPoint centre = { dst.x + half_w, dst.y + half_h };
+    const std::array<SDL_FPoint, 4> corners = {{
+            { -half_w, -half_h }, { half_w, -half_h }, { half_w, half_h }, { -half_w, half_h }
+        }
+    };
+    const int base = static_cast<int>( vertices.size() );
+    for( size_t i = 0; i < corners.size(); ++i ) {
+        SDL_FPoint c = corners[i];
+        if( angle == 90 || angle == -270 ) {
+            c = SDL_FPoint{ -c.y, c.x };
+        } else if( angle == -90 || angle == 270 ) {
+            c = SDL_FPoint{ c.y, -c.x };
+        } else if( angle == 180 || angle == -180 ) {
+            c = SDL_FPoint{ -c.x, -c.y };
+        }
+        vertices.push_back( SDL_Vertex{ SDL_FPoint{ centre.x + c.x, centre.y + c.y },
+                                        SDL_Color{ 255, 255, 255, 255 }, uv[i] } );
+    }
+    // two triangles per quad
+    static constexpr std::array<int, 6> quad_indices = {{ 0, 1, 2, 0, 2, 3 }};
+    for( const int i : quad_indices ) {
+        indices.push_back( base + i );
+    }
+#else
+    printErrorIf( tex.render_copy_ex( renderer, &dst, angle, nullptr, flip ) != 0,
+                  "SDL_RenderCopyEx() failed" );
+#endif
+}
+
+void sprite_batch::flush()
+{
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if( !vertices.empty() ) {
+        printErrorIf( SDL_RenderGeometry( renderer.get(), current, vertices.data(),
+                                          static_cast<int>( vertices.size() ), indices.data(),
+                                          static_cast<int>( indices.size() ) ) != 0,
+                      "SDL_RenderGeometry failed" );
+        vertices.clear();
+        indices.clear();
+    }
+    current = nullptr;
+#endif
+}
+
+int cata_tiles::render_sprite( const texture &tex, const SDL_Rect &dst, const int angle,
+                              const SDL_RendererFlip flip )
+{
+    if( recording_map_layer ) {
+        map_draw_op &op = map_layer_cur.ops.emplace_back();
+        op.cell = map_layer_cell;
+        op.tex = &tex;
+        op.dst = dst;
+        op.angle = angle;
+        op.flip = flip;
+        return 0;
+    }
+    return tex.render_copy_ex( renderer, &dst, angle, nullptr, flip );
+}
+
+void cata_tiles::render_rect( const SDL_Rect &rect, const SDL_Color &color, const bool blend )
+{
+    if( recording_map_layer ) {
+        map_draw_op &op = map_layer_cur.ops.emplace_back();
+        op.cell = map_layer_cell;
+        op.dst = rect;
+        op.color = color;
+        op.blend = blend;
+        return;
+    }
+    if( blend ) {
+        // Change blend mode for transparency to work
+        // Disable after to avoid visual bugs
+        SetRenderDrawBlendMode( renderer, SDL_BLENDMODE_BLEND );
+        geometry->rect( renderer, rect, color );
+        SetRenderDrawBlendMode( renderer, SDL_BLENDMODE_NONE );
+    } else {
+        geometry->rect( renderer, rect, color );
+    }
+}
+
+void cata_tiles::replay_map_draw_op( const map_draw_op &op, const point &offset )
+{
+    SDL_Rect dst = op.dst;
+    dst.x -= offset.x;
+    dst.y -= offset.y;
+    if( op.tex ) {
+        map_sprites.add( *op.tex, dst, op.angle, op.flip );
+    } else {
+        map_sprites.flush();
+        render_rect( dst, op.color, op.blend );
+    }
+}
+
+void cata_tiles::flush_map_layer( const SDL_Rect &viewport )
+{
+    map_layer_cur.index();
+    const point size( viewport.w, viewport.h );
+    std::optional<std::vector<SDL_Rect>> damage;
+    if( map_layer && map_layer_valid && size == map_layer_size ) {
+        // past half of the viewport a single full redraw issues fewer draw calls
+        damage = map_layer_damage( map_layer_prev, map_layer_cur, 16,
+                                   static_cast<int64_t>( size.x ) * size.y / 2 );
+    } else if( !map_layer || size != map_layer_size ) {
+        map_layer = CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                   size.x, size.y );
+        map_layer_size = size;
+        if( map_layer ) {
+            SetTextureBlendMode( map_layer, SDL_BLENDMODE_NONE );
+        }
+    }
+    const point offset( viewport.x, viewport.y );
+    if( !map_layer ) {
+        // no render target to retain the layer in, draw straight to the screen
+        for( const map_draw_op &op : map_layer_cur.ops ) {
+            replay_map_draw_op( op, point_zero );
+        }
+        map_sprites.flush();
+        map_layer_valid = false;
+    } else {
+        if( !damage ) {
+            damage = std::vector<SDL_Rect> { viewport };
+        }
+        if( !damage->empty() ) {
+            SDL_Texture *const screen_target = SDL_GetRenderTarget( renderer.get() );
+            SetRenderTarget( renderer, map_layer );
+            for( const SDL_Rect &area : *damage ) {
+                const SDL_Rect clip = { area.x - offset.x, area.y - offset.y, area.w, area.h };
+                printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clip ) != 0,
+                              "SDL_RenderSetClipRect failed" );
+                geometry->rect( renderer, clip, SDL_Color() );
+                for( const map_draw_op &op : map_layer_cur.ops ) {
+                    if( rects_overlap( op.bounds(), area ) ) {
+                        replay_map_draw_op( op, offset );
+                    }
+                }
+                map_sprites.flush();
+            }
+            printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
+                          "SDL_RenderSetClipRect failed" );
+            printErrorIf( SDL_SetRenderTarget( renderer.get(), screen_target ) != 0,
+                          "SDL_SetRenderTarget failed" );
+            printErrorIf( SDL_RenderSetClipRect( renderer.get(), &viewport ) != 0,
+                          "SDL_RenderSetClipRect failed" );
+        }
+        RenderCopy( renderer, map_layer, nullptr, &viewport );
+        map_layer_valid = true;
+    }
+    std::swap( map_layer_prev, map_layer_cur );
+    map_layer_cur.clear();
+}
+
+void cata_tiles::invalidate_map_layer()
+{
+    map_layer_valid = false;
+}
+
 bool cata_tiles::would_apply_vision_effects( const visibility_type visibility ) const
 {
     return visibility != visibility_type::CLEAR;
@@ -3193,7 +3557,7 @@ void cata_tiles::draw_square_below( const point &p, const nc_color &col, const i
         sdlrect.x = screen.x + divide_round_down( tile_width - sdlrect.w, 2 );
         sdlrect.y = screen.y + divide_round_down( tile_height - sdlrect.h, 2 );
     }
-    geometry->rect( renderer, sdlrect, sdlcol );
+    render_rect( sdlrect, sdlcol, false );
 }
 
 bool cata_tiles::draw_terrain_below( const tripoint &p, const lit_level, int &,
@@ -4303,11 +4667,8 @@ void cata_tiles::draw_zlevel_overlay( const tripoint &p, const lit_level ll, int
     // On isometric tilesets, fog intensity scales with zlevel_height in tile_config.json
     fog_color.a = fog_alpha;
 
-    // Change blend mode for transparency to work
-    // Disable after to avoid visual bugs
-    SetRenderDrawBlendMode( renderer, SDL_BLENDMODE_BLEND );
-    geometry->rect( renderer, draw_rect, fog_color );
-    SetRenderDrawBlendMode( renderer, SDL_BLENDMODE_NONE );
+    // Blended for the fog to be transparent
+    render_rect( draw_rect, fog_color, true );
 }
 
 void cata_tiles::draw_entity_with_overlays( const Character &ch, const tripoint &p, lit_level ll,
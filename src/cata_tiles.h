@@ -2,9 +2,12 @@
 #ifndef CATA_SRC_CATA_TILES_H
 #define CATA_SRC_CATA_TILES_H
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -115,6 +118,8 @@ class tile_lookup_res
 
 class texture
 {
+        friend class sprite_batch;
+
     private:
         std::shared_ptr<SDL_Texture> sdl_texture_ptr;
         SDL_Rect srcrect = { 0, 0, 0, 0 };
@@ -140,6 +145,33 @@ class texture
         }
 };
 
+/**
+ * Collects sprite copies that share a texture and submits them with a single
+ * SDL_RenderGeometry call instead of one SDL_RenderCopyEx each. Draw order is
+ * kept: the batch is submitted whenever the texture changes, and it must be
+ * flushed before anything else is rendered or the clip rectangle changes.
+ */
+class sprite_batch
+{
+    public:
+        explicit sprite_batch( const SDL_Renderer_Ptr &renderer ) : renderer( renderer ) {}
+
+        /** Queues the same copy as `tex.render_copy_ex( renderer, &dst, angle, nullptr, flip )`,
+         *  for angles that are multiples of 90 degrees. */
+        void add( const texture &tex, const SDL_Rect &dst, int angle, SDL_RendererFlip flip );
+        /** Submits everything queued so far. */
+        void flush();
+
+    private:
+        const SDL_Renderer_Ptr &renderer;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+        SDL_Texture *current = nullptr;
+        point current_size;
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+#endif
+};
+
 class layer_variant
 {
     public:
@@ -407,6 +439,45 @@ struct formatted_text {
  */
 using color_block_overlay_container = std::pair<SDL_BlendMode, std::multimap<point, SDL_Color>>;
 
+/** A render call recorded while drawing the map layers, so that it can be compared
+ *  against the previous frame and replayed into the areas that changed. */
+struct map_draw_op {
+    // draw point the op was issued for
+    tripoint cell;
+    // nullptr for a filled rectangle of `color`
+    const texture *tex = nullptr;
+    SDL_Rect dst = { 0, 0, 0, 0 };
+    int angle = 0;
+    SDL_RendererFlip flip = SDL_FLIP_NONE;
+    SDL_Color color = { 0, 0, 0, 0 };
+    bool blend = false;
+
+    /** Screen area the op may touch, including rotated sprites. */
+    SDL_Rect bounds() const;
+    /** Whether both ops put the same pixels on screen. */
+    bool same_output( const map_draw_op &rhs ) const;
+};
+
+/** Draw ops of one frame of the map layers, in the order they were issued. */
+struct map_layer_frame {
+    std::vector<map_draw_op> ops;
+    // indices into `ops` grouped by cell, keeping draw order within a cell
+    std::vector<size_t> by_cell;
+
+    void clear();
+    /** Builds `by_cell`; call once all ops of the frame are recorded. */
+    void index();
+};
+
+/**
+ * Screen areas whose draw ops differ between two indexed frames, merged into
+ * non-touching rectangles. Returns std::nullopt if redrawing everything is
+ * cheaper, i.e. when more than `max_rects` rectangles or `max_area` pixels
+ * would need to be redrawn.
+ */
+std::optional<std::vector<SDL_Rect>> map_layer_damage(
+    const map_layer_frame &prev, const map_layer_frame &cur, size_t max_rects, int64_t max_area );
+
 class cata_tiles
 {
         friend class cata_tiles_test_helper;
@@ -458,9 +529,16 @@ class cata_tiles
 
         std::optional<tile_lookup_res> find_tile_with_season( const std::string &id ) const;
 
+        /** Resolves id (and variant) to a tile, following looks_like chains. Results are
+         *  cached until the season changes or the tileset is (re)loaded. */
+        std::optional<tile_lookup_res>
+        find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
+                              const std::string &variant ) const;
+        /** Uncached lookup backing find_tile_looks_like. */
         std::optional<tile_lookup_res>
-        find_tile_looks_like( const std::string &id, TILE_CATEGORY category, const std::string &variant,
-                              int looks_like_jumps_limit = 10 ) const;
+        resolve_tile_looks_like( const std::string &id, TILE_CATEGORY category,
+                                 const std::string &variant, int looks_like_jumps_limit ) const;
+        void clear_looks_like_cache() const;
 
         // this templated method is used only from it's own cpp file, so it's ok to declare it here
         template<typename T>
@@ -508,6 +586,14 @@ class cata_tiles
         bool draw_tile_at( const tile_type &tile, const point &, unsigned int loc_rand, int rota,
                            lit_level ll, bool apply_night_vision_goggles, int retract, int &height_3d,
                            const point &offset );
+        /** Renders a sprite, or records it while the map layers are drawn. */
+        int render_sprite( const texture &tex, const SDL_Rect &dst, int angle, SDL_RendererFlip flip );
+        /** Fills a rectangle, or records it while the map layers are drawn. */
+        void render_rect( const SDL_Rect &rect, const SDL_Color &color, bool blend );
+        void replay_map_draw_op( const map_draw_op &op, const point &offset );
+        /** Brings the retained map layer up to date with the recorded ops and
+         *  copies it to `viewport`. */
+        void flush_map_layer( const SDL_Rect &viewport );
 
         /* Tile Picking */
         void get_tile_values( int t, const std::array<int, 4> &tn, int &subtile, int &rotation,
@@ -750,6 +836,13 @@ class cata_tiles
         tileset_cache &cache;
         std::shared_ptr<const tileset> tileset_ptr;
 
+        // find_tile_looks_like results by category, id and variant
+        using looks_like_variant_cache =
+            std::unordered_map<std::string, std::optional<tile_lookup_res>>;
+        mutable std::array<std::unordered_map<std::string, looks_like_variant_cache>,
+                static_cast<size_t>( TILE_CATEGORY::last )> looks_like_cache;
+        mutable season_type looks_like_cache_season = season_type::NUM_SEASONS;
+
         // the scaled default sprite width and height. in non-isometric mode,
         // the basic tile width and height equal the default sprite width and
         // height, but in isometric mode, the basic tile height is always
@@ -838,9 +931,25 @@ class cata_tiles
 
         pimpl<pixel_minimap> minimap;
 
+        // Map layers of the last frame, kept as a render target so that later
+        // frames only redraw the areas whose draw ops changed
+        SDL_Texture_Ptr map_layer;
+        point map_layer_size;
+        bool map_layer_valid = false;
+        map_layer_frame map_layer_prev;
+        map_layer_frame map_layer_cur;
+        // while set, sprites are recorded into map_layer_cur for map_layer_cell
+        bool recording_map_layer = false;
+        tripoint map_layer_cell;
+        // submits the map layer sprites when the retained layer is redrawn
+        sprite_batch map_sprites;
+
     public:
         // Draw caches persist data between draws and are only recalculated when dirty
         void set_draw_cache_dirty();
+        // Forces the next draw to redraw the whole retained map layer, e.g. after
+        // the contents of render targets were lost
+        void invalidate_map_layer();
 
         std::string memory_map_mode = "color_pixel_sepia";
 };
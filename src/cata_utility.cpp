@@ -18,12 +18,14 @@
 #include <stdexcept>
 #include <string>
 
+#include "async_save.h"
 #include "cached_options.h"
 #include "cata_path.h"
 #include "catacharset.h"
 #include "debug.h"
 #include "filesystem.h"
 #include "flexbuffer_json.h"
+#include "gzip_stream.h"
 #include "json.h"
 #include "json_loader.h"
 #include "ofstream_wrapper.h"
@@ -285,19 +287,44 @@ float multi_lerp( const std::vector<std::pair<float, float>> &points, float x )
     return ( t * points[i].second ) + ( ( 1 - t ) * points[i - 1].second );
 }
 
-void write_to_file( const std::string &path, const std::function<void( std::ostream & )> &writer )
+static void write_to_path( const fs::path &path,
+                           const std::function<void( std::ostream & )> &writer,
+                           const char *const fail_message, const bool compress = false )
 {
+    if( async_save::deferring() ) {
+        // Serialize now, the file itself is written (and compressed) by the background writer.
+        std::ostringstream contents;
+        writer( contents );
+        if( !contents ) {
+            throw std::runtime_error( "serializing failed" );
+        }
+        async_save::write( path, contents.str(), fail_message ? fail_message : "", compress );
+        return;
+    }
+    // Don't race a background write of the same file.
+    async_save::wait_for( path );
     // Any of the below may throw. ofstream_wrapper will clean up the temporary path on its own.
-    ofstream_wrapper fout( fs::u8path( path ), std::ios::binary );
-    writer( fout.stream() );
+    ofstream_wrapper fout( path, std::ios::binary );
+    if( compress ) {
+        gzip_ostream gzout( fout.stream() );
+        writer( gzout );
+        gzout.finish();
+    } else {
+        writer( fout.stream() );
+    }
     fout.close();
 }
 
+void write_to_file( const std::string &path, const std::function<void( std::ostream & )> &writer )
+{
+    write_to_path( fs::u8path( path ), writer, nullptr );
+}
+
 bool write_to_file( const std::string &path, const std::function<void( std::ostream & )> &writer,
                     const char *const fail_message )
 {
     try {
-        write_to_file( path, writer );
+        write_to_path( fs::u8path( path ), writer, fail_message );
         return true;
 
     } catch( const std::exception &err ) {
@@ -317,17 +344,14 @@ bool write_to_file( const std::string &path, const std::function<void( std::ostr
 
 void write_to_file( const cata_path &path, const std::function<void( std::ostream & )> &writer )
 {
-    // Any of the below may throw. ofstream_wrapper will clean up the temporary path on its own.
-    ofstream_wrapper fout( path.get_unrelative_path(), std::ios::binary );
-    writer( fout.stream() );
-    fout.close();
+    write_to_path( path.get_unrelative_path(), writer, nullptr );
 }
 
 bool write_to_file( const cata_path &path, const std::function<void( std::ostream & )> &writer,
                     const char *const fail_message )
 {
     try {
-        write_to_file( path, writer );
+        write_to_path( path.get_unrelative_path(), writer, fail_message );
         return true;
 
     } catch( const std::exception &err ) {
@@ -345,6 +369,139 @@ bool write_to_file( const cata_path &path, const std::function<void( std::ostrea
     }
 }
 
+static bool compress_save_files()
+{
+    return get_option<bool>( "COMPRESS_SAVES" );
+}
+
+void write_to_save_file( const cata_path &path,
+                         const std::function<void( std::ostream & )> &writer )
+{
+    write_to_path( path.get_unrelative_path(), writer, nullptr, compress_save_files() );
+}
+
+bool write_to_save_file( const cata_path &path, const std::function<void( std::ostream & )> &writer,
+                         const char *const fail_message )
+{
+    try {
+        write_to_path( path.get_unrelative_path(), writer, fail_message, compress_save_files() );
+        return true;
+
+    } catch( const std::exception &err ) {
+        if( fail_message ) {
+            const std::string msg =
+                string_format( _( "Failed to write %1$s to \"%2$s\": %3$s" ),
+                               fail_message, path.generic_u8string(), err.what() );
+            if( test_mode ) {
+                DebugLog( D_ERROR, DC_ALL ) << msg;
+            } else {
+                popup( "%s", msg );
+            }
+        }
+        return false;
+    }
+}
+
+class gzip_ostream::buffer : public std::streambuf
+{
+    public:
+        buffer( std::ostream &target, const int level ) : target( target ) {
+            memset( &zs, 0, sizeof( zs ) );
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+            // MAX_WBITS | 16 selects the gzip format, which the readers detect by its header
+            if( deflateInit2( &zs, level, Z_DEFLATED, MAX_WBITS | 16, 8, Z_DEFAULT_STRATEGY ) != Z_OK ) {
+#pragma GCC diagnostic pop
+                throw std::runtime_error( "deflateInit failed while compressing." );
+            }
+            setp( input.data(), input.data() + input.size() );
+        }
+        ~buffer() override {
+            deflateEnd( &zs );
+        }
+
+        void finish() {
+            if( finished ) {
+                return;
+            }
+            finished = true;
+            if( !failed && !deflate_input( Z_FINISH ) ) {
+                failed = true;
+            }
+            if( failed ) {
+                throw std::runtime_error( "compressing failed" );
+            }
+        }
+
+        void mark_failed() {
+            failed = true;
+        }
+
+    protected:
+        int_type overflow( const int_type ch ) override {
+            if( failed || finished || !deflate_input( Z_NO_FLUSH ) ) {
+                failed = true;
+                return traits_type::eof();
+            }
+            if( !traits_type::eq_int_type( ch, traits_type::eof() ) ) {
+                *pptr() = traits_type::to_char_type( ch );
+                pbump( 1 );
+            }
+            return traits_type::not_eof( ch );
+        }
+
+    private:
+        // Compress everything in the put area and write the output to the target stream.
+        bool deflate_input( const int flush ) {
+            zs.next_in = reinterpret_cast<Bytef *>( pbase() );
+            zs.avail_in = pptr() - pbase();
+            do {
+                zs.next_out = reinterpret_cast<Bytef *>( output.data() );
+                zs.avail_out = output.size();
+                if( deflate( &zs, flush ) == Z_STREAM_ERROR ) {
+                    return false;
+                }
+                target.write( output.data(), output.size() - zs.avail_out );
+                if( !target ) {
+                    return false;
+                }
+            } while( zs.avail_out == 0 );
+            setp( input.data(), input.data() + input.size() );
+            return true;
+        }
+
+        std::ostream &target;
+        z_stream zs;
+        std::array<char, 32768> input;
+        std::array<char, 32768> output;
+        bool finished = false;
+        bool failed = false;
+};
+
+gzip_ostream::gzip_ostream( std::ostream &target, const int level )
+    : std::ostream( nullptr ), buf( std::make_unique<buffer>( target, level ) )
+{
+    rdbuf( buf.get() );
+}
+
+gzip_ostream::~gzip_ostream()
+{
+    try {
+        buf->finish();
+    } catch( ... ) {
+        // ignored in destructor
+    }
+}
+
+void gzip_ostream::finish()
+{
+    if( fail() ) {
+        // Don't complete a stream with data missing in the middle
+        buf->mark_failed();
+    }
+    buf->finish();
+}
+
 ofstream_wrapper::ofstream_wrapper( const fs::path &path, const std::ios::openmode mode )
     : path( path )
 
@@ -476,6 +633,7 @@ std::unique_ptr<std::istream> read_maybe_compressed_file( const std::string &pat
 
 std::unique_ptr<std::istream> read_maybe_compressed_file( const fs::path &path )
 {
+    async_save::wait_for( path );
     try {
         std::ifstream fin( path, std::ios::binary );
         if( !fin ) {
@@ -519,6 +677,7 @@ std::optional<std::string> read_whole_file( const std::string &path )
 
 std::optional<std::string> read_whole_file( const fs::path &path )
 {
+    async_save::wait_for( path );
     std::string outstring;
     try {
         std::ifstream fin( path, std::ios::binary );
@@ -562,6 +721,7 @@ std::optional<std::string> read_whole_file( const cata_path &path )
 bool read_from_file_json( const cata_path &path,
                           const std::function<void( const JsonValue & )> &reader )
 {
+    async_save::wait_for( path.get_unrelative_path() );
     try {
         JsonValue jo = json_loader::from_path( path );
         reader( jo );
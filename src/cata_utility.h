@@ -312,6 +312,10 @@ class list_circularizer
  * happens, the function shows a popup containing the
  * \p fail_message, the error text and the path.
  *
+ * While an @ref async_save::batch is active, the writer is still called immediately, but the
+ * file is written by a background thread and errors from that are reported through
+ * @ref async_save::finished instead.
+ *
  * @return Whether saving succeeded (no error was caught).
  * @throw The void function throws when writing fails or when the @p writer throws.
  * The other function catches all exceptions and returns false.
@@ -325,6 +329,22 @@ bool write_to_file( const cata_path &path, const std::function<void( std::ostrea
 void write_to_file( const cata_path &path, const std::function<void( std::ostream & )> &writer );
 ///@}
 
+/**
+ * Like @ref write_to_file, but used for the bulky files of the world save (map quads,
+ * overmaps, map memory). If the "COMPRESS_SAVES" option of the world is enabled, the
+ * file is gzip compressed while it is written (see @ref gzip_ostream).
+ *
+ * The read functions below detect compressed files by their header, so a world can
+ * contain both kinds of files and the option can be changed at any time.
+ */
+///@{
+bool write_to_save_file( const cata_path &path,
+                         const std::function<void( std::ostream & )> &writer,
+                         const char *fail_message );
+void write_to_save_file( const cata_path &path,
+                         const std::function<void( std::ostream & )> &writer );
+///@}
+
 /**
  * Try to open and read from given file using the given callback.
  *
@@ -675,6 +695,22 @@ bool map_equal_ignoring_keys( const Map &lhs, const Map &rhs, const Set &ignore_
     return lbegin == lend && rbegin == rend;
 }
 
+/**
+ * Estimated heap bytes of a std::set or std::map holding @p count elements of type T.
+ * Each element is in its own tree node, next to a color and three pointers.
+ */
+template<typename T>
+size_t tree_heap_bytes( size_t count )
+{
+    return count * ( sizeof( T ) + 4 * sizeof( void * ) );
+}
+
+/** Heap bytes of @p s, zero while it fits into the string's inline buffer. */
+inline size_t string_heap_bytes( const std::string &s )
+{
+    return s.capacity() > std::string().capacity() ? s.capacity() + 1 : 0;
+}
+
 int modulo( int v, int m );
 
 /** Add elements from one set to another */
@@ -3184,14 +3184,7 @@ units::mass Character::weight_carried_with_tweaks( const item_tweaks &tweaks ) c
     // Wielded item
     units::mass weaponweight = 0_gram;
     if( !without.count( &weapon ) ) {
-        weaponweight += weapon.weight();
-        for( const item *i : weapon.all_items_ptr( pocket_type::CONTAINER ) ) {
-            if( i->count_by_charges() ) {
-                weaponweight -= get_selected_stack_weight( i, without );
-            } else if( without.count( i ) ) {
-                weaponweight -= i->weight();
-            }
-        }
+        weaponweight += weapon.weight() - get_selected_contents_weight( weapon, without );
     } else if( weapon.count_by_charges() ) {
         weaponweight += weapon.weight() - get_selected_stack_weight( &weapon, without );
     }
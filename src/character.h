@@ -3,6 +3,7 @@
 #define CATA_SRC_CHARACTER_H
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <climits>
 #include <cstdint>
@@ -301,71 +302,66 @@ struct queued_eoc {
         std::unordered_map<std::string, std::string> context;
 };
 
-struct eoc_compare {
-    bool operator()( const queued_eoc &lhs, const queued_eoc &rhs ) const {
-        return lhs.time > rhs.time;
-    }
-};
-
-struct queued_eocs {
-    using storage_iter = std::list<queued_eoc>::iterator;
-
-    struct eoc_compare : ::eoc_compare {
-        bool operator()( const storage_iter &lhs, const storage_iter &rhs ) const {
-            return ::eoc_compare::operator()( *lhs, *rhs );
-        }
-    };
-    std::priority_queue<storage_iter, std::vector<storage_iter>, eoc_compare> queue;
-    std::list<queued_eoc> list;
+/**
+ * Queue of effect_on_conditions keyed by the turn they are due.
+ *
+ * Entries live in #list.  The schedule is a hierarchical timing wheel of iterators into it: each
+ * level has 64 slots, level 0 slots are single turns and each slot of the levels above spans a
+ * whole revolution of the level below.  Entries too far in the future wait in an overflow bucket.
+ * Queueing is O(1), and collecting everything due this turn only visits occupied slots.
+ */
+class queued_eocs
+{
+    public:
+        using storage_iter = std::list<queued_eoc>::iterator;
 
-    queued_eocs() = default;
+        // every queued eoc, in no particular order
+        std::list<queued_eoc> list;
 
-    queued_eocs( const queued_eocs &rhs ) {
-        list = rhs.list;
-        for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
-            queue.emplace( it );
-        }
-    };
-    queued_eocs( queued_eocs &&rhs ) noexcept {
-        queue.swap( rhs.queue );
-        list.swap( rhs.list );
-    }
+        queued_eocs() = default;
+        queued_eocs( const queued_eocs &rhs );
+        queued_eocs( queued_eocs &&rhs ) noexcept = default;
+        queued_eocs &operator=( const queued_eocs &rhs );
+        queued_eocs &operator=( queued_eocs &&rhs ) noexcept = default;
 
-    queued_eocs &operator=( const queued_eocs &rhs ) {
-        list = rhs.list;
-        // Why doesn't std::priority_queue have a clear() function.
-        queue = {};
-        for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
-            queue.emplace( it );
+        bool empty() const {
+            return list.empty();
         }
-        return *this;
-    }
-    queued_eocs &operator=( queued_eocs &&rhs ) noexcept {
-        queue.swap( rhs.queue );
-        list.swap( rhs.list );
-        return *this;
-    }
-
-    /* std::priority_queue compatibility layer where performance is less relevant */
-
-    bool empty() const {
-        return queue.empty();
-    }
-
-    const queued_eoc &top() const {
-        return *queue.top();
-    }
-
-    void push( const queued_eoc &eoc ) {
-        auto it = list.emplace( list.end(), eoc );
-        queue.push( it );
-    }
+        void push( const queued_eoc &eoc );
+        void clear();
+        /** Removes every queued eoc for which @p pred returns true. */
+        void remove_if( const std::function<bool( const queued_eoc & )> &pred );
+        /**
+         * Takes the next eoc due at or before @p now off the schedule.  The entry stays in #list
+         * until it is passed to reschedule() or discard().
+         */
+        std::optional<storage_iter> pop_due( const time_point &now );
+        /** Puts an entry returned by pop_due() back on the schedule at its (updated) time. */
+        void reschedule( storage_iter it );
+        /** Drops an entry returned by pop_due(). */
+        void discard( storage_iter it );
 
-    void pop() {
-        auto it = queue.top();
-        queue.pop();
-        list.erase( it );
-    }
+    private:
+        static constexpr int bits = 6;
+        static constexpr int levels = 5;
+        static constexpr std::int64_t slot_mask = ( 1 << bits ) - 1;
+
+        // first turn that has not been collected yet
+        std::int64_t cursor = 0;
+        // levels * 64 slots, allocated on first use
+        std::vector<std::vector<storage_iter>> slots;
+        std::array<std::uint64_t, levels> occupied = {};
+        std::vector<storage_iter> overflow;
+        // collected entries waiting to be handed out by pop_due(), starting at due_next
+        std::vector<storage_iter> due;
+        std::size_t due_next = 0;
+        // entries handed out by pop_due() and not yet returned
+        std::size_t held = 0;
+
+        void schedule( storage_iter it );
+        void advance( std::int64_t now );
+        void cascade();
+        void rebuild();
 };
 
 struct aim_type {
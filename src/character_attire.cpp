@@ -50,6 +50,7 @@
 #include "translations.h"
 #include "value_ptr.h"
 #include "viewer.h"
+#include "visitable.h"
 
 static const efftype_id effect_bleed( "bleed" );
 static const efftype_id effect_heating_bionic( "heating_bionic" );
@@ -106,6 +107,27 @@ units::mass get_selected_stack_weight( const item *i, const std::map<const item
     return 0_gram;
 }
 
+units::mass get_selected_contents_weight( const item &container,
+        const std::map<const item *, int> &without )
+{
+    units::mass ret = 0_gram;
+    if( without.empty() ) {
+        return ret;
+    }
+    container.visit_items( [&]( const item * i, item * ) {
+        if( i == &container ) {
+            return VisitResponse::NEXT;
+        }
+        if( i->count_by_charges() ) {
+            ret += get_selected_stack_weight( i, without );
+        } else if( without.count( i ) ) {
+            ret += i->weight();
+        }
+        return VisitResponse::NEXT;
+    } );
+    return ret;
+}
+
 ret_val<void> Character::can_wear( const item &it, bool with_equip_change ) const
 {
     if( it.has_flag( flag_INTEGRATED ) ) {
@@ -1197,14 +1219,7 @@ units::mass outfit::weight_carried_with_tweaks( const std::map<const item *, int
         if( without.empty() ) {
             ret += i.weight();
         } else if( !without.count( &i ) ) {
-            for( const item *j : i.all_items_ptr( pocket_type::CONTAINER ) ) {
-                if( j->count_by_charges() ) {
-                    ret -= get_selected_stack_weight( j, without );
-                } else if( without.count( j ) ) {
-                    ret -= j->weight();
-                }
-            }
-            ret += i.weight();
+            ret += i.weight() - get_selected_contents_weight( i, without );
         }
     }
     return ret;
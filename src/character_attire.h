@@ -263,6 +263,9 @@ class outfit
 };
 
 units::mass get_selected_stack_weight( const item *i, const std::map<const item *, int> &without );
+// weight of everything in the containers of @p container that is taken out by @p without
+units::mass get_selected_contents_weight( const item &container,
+        const std::map<const item *, int> &without );
 void post_absorbed_damage_enchantment_adjust( Character &guy, damage_unit &du );
 void destroyed_armor_msg( Character &who, const std::string &pre_damage_name );
 
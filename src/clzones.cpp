@@ -5,6 +5,7 @@
 #include <functional>
 #include <iosfwd>
 #include <iterator>
+#include <optional>
 #include <string>
 #include <tuple>
 
@@ -109,6 +110,8 @@ void zone_manager::clear()
     // Do not clear types since it is needed for the next games.
     area_cache.clear();
     vzone_cache.clear();
+    area_bounds_cache.clear();
+    vzone_bounds_cache.clear();
 }
 
 std::string zone_type::name() const
@@ -851,9 +854,61 @@ bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac
     return type_iter != area_cache.end();
 }
 
+// Adds all points of the zone to the point cache and its bounds to the bounds cache
+static void cache_zone_points( const zone_data &zone, std::unordered_set<tripoint_abs_ms> &cache,
+                               std::vector<inclusive_cuboid<tripoint_abs_ms>> &bounds )
+{
+    std::optional<inclusive_cuboid<tripoint_abs_ms>> zone_bounds;
+    for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
+             zone.get_start_point(), zone.get_end_point() ) ) {
+        cache.insert( p );
+        if( !zone_bounds ) {
+            zone_bounds.emplace( p, p );
+        } else {
+            zone_bounds->p_min = tripoint_abs_ms( std::min( zone_bounds->p_min.x(), p.x() ),
+                                                  std::min( zone_bounds->p_min.y(), p.y() ),
+                                                  std::min( zone_bounds->p_min.z(), p.z() ) );
+            zone_bounds->p_max = tripoint_abs_ms( std::max( zone_bounds->p_max.x(), p.x() ),
+                                                  std::max( zone_bounds->p_max.y(), p.y() ),
+                                                  std::max( zone_bounds->p_max.z(), p.z() ) );
+        }
+    }
+    if( zone_bounds ) {
+        bounds.push_back( *zone_bounds );
+    }
+}
+
+// Distance from `where` to the closest point inside `bounds`
+static int square_dist( const inclusive_cuboid<tripoint_abs_ms> &bounds,
+                        const tripoint_abs_ms &where )
+{
+    return square_dist( clamp( where, bounds ), where );
+}
+
+// Calls func for every point inside `bounds` within `range` of `where`, z-levels are limited
+// to [min_z, max_z]
+template<typename Func>
+static void for_each_point_near( const inclusive_cuboid<tripoint_abs_ms> &bounds,
+                                 const tripoint_abs_ms &where, int range, int min_z, int max_z, Func func )
+{
+    const tripoint_abs_ms p_min( std::max( bounds.p_min.x(), where.x() - range ),
+                                 std::max( bounds.p_min.y(), where.y() - range ),
+                                 std::max( { bounds.p_min.z(), where.z() - range, min_z } ) );
+    const tripoint_abs_ms p_max( std::min( bounds.p_max.x(), where.x() + range ),
+                                 std::min( bounds.p_max.y(), where.y() + range ),
+                                 std::min( { bounds.p_max.z(), where.z() + range, max_z } ) );
+    if( p_min.x() > p_max.x() || p_min.y() > p_max.y() || p_min.z() > p_max.z() ) {
+        return;
+    }
+    for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>( p_min, p_max ) ) {
+        func( p );
+    }
+}
+
 void zone_manager::cache_data( bool update_avatar )
 {
     area_cache.clear();
+    area_bounds_cache.clear();
     avatar &player_character = get_avatar();
     tripoint_abs_ms cached_shift = player_character.get_location();
     for( zone_data &elem : zones ) {
@@ -868,13 +923,7 @@ void zone_manager::cache_data( bool update_avatar )
         }
 
         const std::string &type_hash = elem.get_type_hash();
-        auto &cache = area_cache[type_hash];
-
-        // Draw marked area
-        for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
-                 elem.get_start_point(), elem.get_end_point() ) ) {
-            cache.insert( p );
-        }
+        cache_zone_points( elem, area_cache[type_hash], area_bounds_cache[type_hash] );
     }
 }
 
@@ -909,6 +958,7 @@ void zone_manager::cache_avatar_location()
 void zone_manager::cache_vzones( map *pmap )
 {
     vzone_cache.clear();
+    vzone_bounds_cache.clear();
     map &here = pmap == nullptr ? get_map() : *pmap;
     auto vzones = here.get_vehicle_zones( here.get_abs_sub().z() );
     for( zone_data *elem : vzones ) {
@@ -917,24 +967,29 @@ void zone_manager::cache_vzones( map *pmap )
         }
 
         const std::string &type_hash = elem->get_type_hash();
-        auto &cache = vzone_cache[type_hash];
-
-        // TODO: looks very similar to the above cache_data - maybe merge it?
-
-        // Draw marked area
-        for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
-                 elem->get_start_point(), elem->get_end_point() ) ) {
-            cache.insert( p );
-        }
+        cache_zone_points( *elem, vzone_cache[type_hash], vzone_bounds_cache[type_hash] );
     }
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_point_set( const zone_type_id &type,
+const std::unordered_set<tripoint_abs_ms> &zone_manager::get_point_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const std::unordered_set<tripoint_abs_ms> empty_set;
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return empty_set;
+    }
+
+    return type_iter->second;
+}
+
+const std::vector<inclusive_cuboid<tripoint_abs_ms>> &zone_manager::get_point_bounds(
+            const zone_type_id &type, const faction_id &fac ) const
+{
+    static const std::vector<inclusive_cuboid<tripoint_abs_ms>> empty_bounds;
+    const auto &type_iter = area_bounds_cache.find( zone_data::make_type_hash( type, fac ) );
+    if( type_iter == area_bounds_cache.end() ) {
+        return empty_bounds;
     }
 
     return type_iter->second;
@@ -951,34 +1006,31 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
 {
     std::unordered_set<tripoint> res;
     map &here = get_map();
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : area_cache ) {
-        zone_type_id type = zone_data::unhash_type( cache.first );
-        faction_id z_fac = zone_data::unhash_fac( cache.first );
-        if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
-            for( tripoint_abs_ms point : cache.second ) {
-                if( square_dist( where, point ) <= radius ) {
-                    res.emplace( here.getlocal( point ) );
-                }
-            }
-        }
-    }
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
-        zone_type_id type = zone_data::unhash_type( cache.first );
-        faction_id z_fac = zone_data::unhash_fac( cache.first );
-        if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
-            for( tripoint_abs_ms point : cache.second ) {
-                if( square_dist( where, point ) <= radius ) {
-                    res.emplace( here.getlocal( point ) );
+    const auto add_loot_points = [&]( const std::unordered_map<std::string,
+    std::vector<inclusive_cuboid<tripoint_abs_ms>>> &bounds_cache ) {
+        for( const std::pair<const std::string, std::vector<inclusive_cuboid<tripoint_abs_ms>>> &cache :
+             bounds_cache ) {
+            zone_type_id type = zone_data::unhash_type( cache.first );
+            faction_id z_fac = zone_data::unhash_fac( cache.first );
+            if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
+                for( const inclusive_cuboid<tripoint_abs_ms> &bounds : cache.second ) {
+                    for_each_point_near( bounds, where, radius, INT_MIN, INT_MAX,
+                    [&]( const tripoint_abs_ms & point ) {
+                        res.emplace( here.getlocal( point ) );
+                    } );
                 }
             }
         }
-    }
+    };
+    add_loot_points( area_bounds_cache );
+    add_loot_points( vzone_bounds_cache );
 
     if( npc_search ) {
-        for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
+        for( const std::pair<const std::string, std::unordered_set<tripoint_abs_ms>> &cache :
+             vzone_cache ) {
             zone_type_id type = zone_data::unhash_type( cache.first );
             if( type == zone_type_NO_NPC_PICKUP ) {
-                for( tripoint_abs_ms point : cache.second ) {
+                for( const tripoint_abs_ms &point : cache.second ) {
                     res.erase( here.getlocal( point ) );
                 }
             }
@@ -988,13 +1040,26 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
     return res;
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_vzone_set( const zone_type_id &type,
+const std::unordered_set<tripoint_abs_ms> &zone_manager::get_vzone_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const std::unordered_set<tripoint_abs_ms> empty_set;
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return empty_set;
+    }
+
+    return type_iter->second;
+}
+
+const std::vector<inclusive_cuboid<tripoint_abs_ms>> &zone_manager::get_vzone_bounds(
+            const zone_type_id &type, const faction_id &fac ) const
+{
+    static const std::vector<inclusive_cuboid<tripoint_abs_ms>> empty_bounds;
+    const auto &type_iter = vzone_bounds_cache.find( zone_data::make_type_hash( type, fac ) );
+    if( type_iter == vzone_bounds_cache.end() ) {
+        return empty_bounds;
     }
 
     return type_iter->second;
@@ -1011,19 +1076,16 @@ bool zone_manager::has( const zone_type_id &type, const tripoint_abs_ms &where,
 bool zone_manager::has_near( const zone_type_id &type, const tripoint_abs_ms &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
+    for( const inclusive_cuboid<tripoint_abs_ms> &bounds : get_point_bounds( type, fac ) ) {
+        if( square_dist( bounds, where ) <= range ) {
             return true;
         }
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
-            }
+    for( const inclusive_cuboid<tripoint_abs_ms> &bounds : get_vzone_bounds( type, fac ) ) {
+        if( bounds.p_min.z() <= where.z() && where.z() <= bounds.p_max.z() &&
+            square_dist( bounds, where ) <= range ) {
+            return true;
         }
     }
 
@@ -1134,28 +1196,23 @@ bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it
 std::unordered_set<tripoint_abs_ms> zone_manager::get_near( const zone_type_id &type,
         const tripoint_abs_ms &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
     std::unordered_set<tripoint_abs_ms> near_point_set;
-
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
-            if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                near_point_set.insert( point );
-            }
+    const bool check_item = type == zone_type_LOOT_CUSTOM || type == zone_type_LOOT_ITEM_GROUP;
+    if( check_item && it == nullptr ) {
+        return near_point_set;
+    }
+    const auto add_point = [&]( const tripoint_abs_ms & point ) {
+        if( !check_item || custom_loot_has( point, it, type, fac ) ) {
+            near_point_set.insert( point );
         }
+    };
+
+    for( const inclusive_cuboid<tripoint_abs_ms> &bounds : get_point_bounds( type, fac ) ) {
+        for_each_point_near( bounds, where, range, INT_MIN, INT_MAX, add_point );
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                    ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                    near_point_set.insert( point );
-                }
-            }
-        }
+    for( const inclusive_cuboid<tripoint_abs_ms> &bounds : get_vzone_bounds( type, fac ) ) {
+        for_each_point_near( bounds, where, range, where.z(), where.z(), add_point );
     }
 
     return near_point_set;
@@ -1170,29 +1227,18 @@ std::optional<tripoint_abs_ms> zone_manager::get_nearest( const zone_type_id &ty
 
     tripoint_abs_ms nearest_pos( INT_MIN, INT_MIN, INT_MIN );
     int nearest_dist = range + 1;
-    const std::unordered_set<tripoint_abs_ms> &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &p : point_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
+    const auto check_bounds = [&]( const std::vector<inclusive_cuboid<tripoint_abs_ms>> &zones ) {
+        for( const inclusive_cuboid<tripoint_abs_ms> &bounds : zones ) {
+            const tripoint_abs_ms p = clamp( where, bounds );
+            const int cur_dist = square_dist( p, where );
+            if( cur_dist < nearest_dist ) {
+                nearest_dist = cur_dist;
+                nearest_pos = p;
             }
         }
-    }
-
-    const std::unordered_set<tripoint_abs_ms> &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &p : vzone_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
-            }
-        }
-    }
+    };
+    check_bounds( get_point_bounds( type, fac ) );
+    check_bounds( get_vzone_bounds( type, fac ) );
     if( nearest_dist > range ) {
         return std::nullopt;
     }
@@ -535,10 +535,20 @@ class zone_manager
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> area_cache;
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> vzone_cache;
-        std::unordered_set<tripoint_abs_ms> get_point_set( const zone_type_id &type,
+        // bounds of every enabled zone in area_cache / vzone_cache, by type hash, so range
+        // queries only have to look at the zones instead of all of their points
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<std::string, std::vector<inclusive_cuboid<tripoint_abs_ms>>> area_bounds_cache;
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<std::string, std::vector<inclusive_cuboid<tripoint_abs_ms>>> vzone_bounds_cache;
+        const std::unordered_set<tripoint_abs_ms> &get_point_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint_abs_ms> get_vzone_set( const zone_type_id &type,
+        const std::unordered_set<tripoint_abs_ms> &get_vzone_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
+        const std::vector<inclusive_cuboid<tripoint_abs_ms>> &get_point_bounds(
+                    const zone_type_id &type, const faction_id &fac = your_fac ) const;
+        const std::vector<inclusive_cuboid<tripoint_abs_ms>> &get_vzone_bounds(
+                    const zone_type_id &type, const faction_id &fac = your_fac ) const;
     public:
         zone_manager();
         ~zone_manager() = default;
@@ -527,6 +527,25 @@ void write_var_value( var_type type, const std::string &name, dialogue *d,
 void write_var_value( var_type type, const std::string &name, dialogue *d,
                       double value )
 {
+    switch( type ) {
+        case var_type::global:
+            get_globals().set_global_value( name, value );
+            return;
+        case var_type::u:
+            if( d->has_alpha ) {
+                d->actor( false )->set_num_value( name, value );
+                return;
+            }
+            break;
+        case var_type::npc:
+            if( d->has_beta ) {
+                d->actor( true )->set_num_value( name, value );
+                return;
+            }
+            break;
+        default:
+            break;
+    }
     // NOLINTNEXTLINE(cata-translate-string-literal)
     write_var_value( type, name, d, string_format( "%g", value ) );
 }
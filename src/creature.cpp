@@ -2040,7 +2040,12 @@ bool Creature::has_trait( const trait_id &/*flag*/ ) const
 // Methods for setting/getting misc key/value pairs.
 void Creature::set_value( const std::string &key, const std::string &value )
 {
-    values[ key ] = value;
+    values[ key ] = var_value( value );
+}
+
+void Creature::set_value( const std::string &key, double value )
+{
+    values[ key ] = var_value( value );
 }
 
 void Creature::remove_value( const std::string &key )
@@ -2056,7 +2061,13 @@ std::string Creature::get_value( const std::string &key ) const
 std::optional<std::string> Creature::maybe_get_value( const std::string &key ) const
 {
     auto it = values.find( key );
-    return it == values.end() ? std::nullopt : std::optional<std::string> { it->second };
+    return it == values.end() ? std::nullopt : std::optional<std::string> { it->second.get_str() };
+}
+
+std::optional<double> Creature::maybe_get_num_value( const std::string &key ) const
+{
+    auto it = values.find( key );
+    return it == values.end() ? std::nullopt : it->second.get_num();
 }
 
 void Creature::clear_values()
@@ -3163,7 +3174,7 @@ bool Creature::is_symbol_highlighted() const
     return false;
 }
 
-std::unordered_map<std::string, std::string> &Creature::get_values()
+std::unordered_map<std::string, var_value> &Creature::get_values()
 {
     return values;
 }
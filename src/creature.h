@@ -31,6 +31,7 @@
 #include "string_formatter.h"
 #include "type_id.h"
 #include "units_fwd.h"
+#include "var_value.h"
 #include "viewer.h"
 #include "weakpoint.h"
 
@@ -680,9 +681,12 @@ class Creature : public viewer
 
         // Methods for setting/getting misc key/value pairs.
         void set_value( const std::string &key, const std::string &value );
+        void set_value( const std::string &key, double value );
         void remove_value( const std::string &key );
         std::string get_value( const std::string &key ) const;
         std::optional<std::string> maybe_get_value( const std::string &key ) const;
+        /** Numeric value of the pair, or nullopt if it is missing or not a number. */
+        std::optional<double> maybe_get_num_value( const std::string &key ) const;
         void clear_values();
 
         virtual units::mass get_weight() const = 0;
@@ -1191,7 +1195,7 @@ class Creature : public viewer
         virtual const std::string &symbol() const = 0;
         virtual bool is_symbol_highlighted() const;
 
-        std::unordered_map<std::string, std::string> &get_values();
+        std::unordered_map<std::string, var_value> &get_values();
         void clear_killer();
         // summoned creatures via spells
         void set_summon_time( const time_duration &length );
@@ -1221,7 +1225,7 @@ class Creature : public viewer
         std::vector<damage_over_time_data> damage_over_time_map;
 
         // Miscellaneous key/value pairs.
-        std::unordered_map<std::string, std::string> values;
+        std::unordered_map<std::string, var_value> values;
 
         // used for innate bonuses like effects. weapon bonuses will be
         // handled separately
@@ -26,6 +26,7 @@
 #include "achievement.h"
 #include "action.h"
 #include "activity_tracker.h"
+#include "async_save.h"
 #include "avatar.h"
 #include "bionics.h"
 #include "bodypart.h"
@@ -77,6 +78,7 @@
 #include "map.h"
 #include "map_extras.h"
 #include "map_iterator.h"
+#include "mapbuffer.h"
 #include "mapgen.h"
 #include "mapgendata.h"
 #include "martialarts.h"
@@ -108,6 +110,7 @@
 #include "stomach.h"
 #include "string_formatter.h"
 #include "string_input_popup.h"
+#include "submap.h"
 #include "talker.h"
 #include "tgz_archiver.h"
 #include "timed_event.h"
@@ -270,6 +273,8 @@ std::string enum_to_string<debug_menu::debug_menu_index>( debug_menu::debug_menu
 		case debug_menu::debug_menu_index::SIX_MILLION_DOLLAR_SURVIVOR: return "SIX_MILLION_DOLLAR_SURVIVOR";
 		case debug_menu::debug_menu_index::EDIT_FACTION: return "EDIT_FACTION";
 		case debug_menu::debug_menu_index::WRITE_CITY_LIST: return "WRITE_CITY_LIST";
+		case debug_menu::debug_menu_index::SHOW_SAVE_STATS: return "SHOW_SAVE_STATS";
+		case debug_menu::debug_menu_index::SHOW_ITEM_MEMORY: return "SHOW_ITEM_MEMORY";
         // *INDENT-ON*
         case debug_menu::debug_menu_index::last:
             break;
@@ -740,6 +745,8 @@ static int info_uilist( bool display_all_entries = true )
         { uilist_entry( debug_menu_index::SAVE_SCREENSHOT, true, 'H', _( "Take screenshot" ) ) },
         { uilist_entry( debug_menu_index::GAME_REPORT, true, 'r', _( "Generate game report" ) ) },
         { uilist_entry( debug_menu_index::GAME_MIN_ARCHIVE, true, '!', _( "Generate minimized save archive" ) ) },
+        { uilist_entry( debug_menu_index::SHOW_SAVE_STATS, true, 'k', _( "Show what the last save wrote" ) ) },
+        { uilist_entry( debug_menu_index::SHOW_ITEM_MEMORY, true, 'u', _( "Show memory used by items" ) ) },
     };
 
     if( display_all_entries ) {
@@ -2516,7 +2523,7 @@ static void character_edit_menu()
                 testfile << "|;key;value;" << std::endl;
 
                 for( const auto &value : you.get_values() ) {
-                    testfile << "|;" << value.first << ";" << value.second << ";" << std::endl;
+                    testfile << "|;" << value.first << ";" << value.second.get_str() << ";" << std::endl;
                 }
 
             }, "var_list" );
@@ -3222,6 +3229,54 @@ static void edit_global_vars()
     globvars.set_global_value( "npctalk_var_" + key, value );
 }
 
+static void show_save_stats()
+{
+    const mapbuffer::save_stats &maps = MAPBUFFER.last_save_stats();
+    const overmapbuffer::save_stats &overmaps = overmap_buffer.last_save_stats();
+    popup( _( "Map quads: %1$d written, %2$d unchanged\n"
+              "Overmaps: %3$d written, %4$d unchanged\n"
+              "Bytes written: %5$s" ),
+           maps.quads_written, maps.quads_unchanged,
+           overmaps.overmaps_written, overmaps.overmaps_unchanged,
+           std::to_string( maps.bytes_written + overmaps.bytes_written ) );
+}
+
+static void show_item_memory()
+{
+    // items lying on the loaded submaps, including everything inside them
+    size_t submaps = 0;
+    size_t items = 0;
+    size_t bytes = 0;
+    for( auto &entry : MAPBUFFER ) {
+        const submap &sm = *entry.second;
+        ++submaps;
+        for( int x = 0; x < SEEX; x++ ) {
+            for( int y = 0; y < SEEY; y++ ) {
+                for( const item &it : sm.get_items( point_sm_ms( x, y ) ) ) {
+                    bytes += it.memory_usage();
+                    it.visit_items( [&items]( const item *, const item * ) {
+                        ++items;
+                        return VisitResponse::NEXT;
+                    } );
+                }
+            }
+        }
+    }
+    const std::string report = string_format(
+                                   _( "Loaded submaps: %1$s\n"
+                                      "Items on them: %2$s\n"
+                                      "Item memory: %3$s bytes\n"
+                                      "Per item: %4$s bytes\n"
+                                      "Per submap: %5$s bytes\n"
+                                      "Size of an item without its allocations: %6$s bytes" ),
+                                   std::to_string( submaps ), std::to_string( items ), std::to_string( bytes ),
+                                   std::to_string( items > 0 ? bytes / items : 0 ),
+                                   std::to_string( submaps > 0 ? bytes / submaps : 0 ),
+                                   std::to_string( sizeof( item ) ) );
+    DebugLog( DL_ALL, DC_ALL ) << "ITEM MEMORY:\n" << report;
+    popup( report );
+}
+
 static void game_report()
 {
     // generate a game report, useful for bug reporting.
@@ -3597,7 +3652,7 @@ static void write_global_vars()
         global_variables &globvars = get_globals();
         auto globals = globvars.get_global_values();
         for( const auto &value : globals ) {
-            testfile << "|;" << value.first << ";" << value.second << ";" << std::endl;
+            testfile << "|;" << value.first << ";" << value.second.get_str() << ";" << std::endl;
         }
 
     }, "var_list" );
@@ -3617,6 +3672,8 @@ void debug()
         debug_menu_index::SAVE_SCREENSHOT,
         debug_menu_index::GAME_REPORT,
         debug_menu_index::GAME_MIN_ARCHIVE,
+        debug_menu_index::SHOW_SAVE_STATS,
+        debug_menu_index::SHOW_ITEM_MEMORY,
         debug_menu_index::ENABLE_ACHIEVEMENTS,
         debug_menu_index::UNLOCK_ALL,
         debug_menu_index::BENCHMARK,
@@ -4023,6 +4080,8 @@ void debug()
             break;
         case debug_menu_index::GAME_MIN_ARCHIVE: {
             g->quicksave();
+            // the archive is built from the files on disk
+            async_save::wait_all();
 
             static_popup popup;
             popup.message( "%s", _( "Writing archive, this may take a while." ) );
@@ -4032,6 +4091,12 @@ void debug()
             write_min_archive();
             break;
         }
+        case debug_menu_index::SHOW_SAVE_STATS:
+            show_save_stats();
+            break;
+        case debug_menu_index::SHOW_ITEM_MEMORY:
+            show_item_memory();
+            break;
         case debug_menu_index::CHANGE_SPELLS:
             change_spells( player_character );
             break;
@@ -112,6 +112,8 @@ enum class debug_menu_index : int {
     SIX_MILLION_DOLLAR_SURVIVOR,
     EDIT_FACTION,
     WRITE_CITY_LIST,
+    SHOW_SAVE_STATS,
+    SHOW_ITEM_MEMORY,
     last
 };
 
@@ -2,7 +2,9 @@
 
 #include <string>
 
+#include "cata_utility.h"
 #include "dialogue.h"
+#include "global_vars.h"
 #include "rng.h"
 #include "talker.h"
 
@@ -58,6 +60,24 @@ std::string read_var_value( const translation_var_info &info, const dialogue &d
     return maybe_read_var_value( info, d ).value_or( info.default_val.translated() );
 }
 
+std::optional<double> maybe_read_var_num( const var_info &info, const dialogue &d )
+{
+    switch( info.type ) {
+        case var_type::global: {
+            const var_value *val = get_globals().find_global_value( info.name );
+            return val == nullptr ? std::nullopt : val->get_num();
+        }
+        case var_type::u:
+            return d.actor( false )->maybe_get_num_value( info.name );
+        case var_type::npc:
+            return d.actor( true )->maybe_get_num_value( info.name );
+        default: {
+            std::optional<std::string> const val = maybe_read_var_value( info, d );
+            return val ? svtod( *val ) : std::nullopt;
+        }
+    }
+}
+
 var_info process_variable( const std::string &type )
 {
     var_type vt = var_type::global;
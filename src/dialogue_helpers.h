@@ -92,6 +92,9 @@ std::string read_var_value( const abstract_var_info<T> &info, const dialogue &d
 template<class T>
 std::optional<std::string> maybe_read_var_value(
     const abstract_var_info<T> &info, const dialogue &d, int call_depth = 0 );
+// Numeric value of the variable without a string round-trip where the storage allows it.
+// Returns nullopt if the variable is missing or not a number.
+std::optional<double> maybe_read_var_num( const var_info &info, const dialogue &d );
 
 var_info process_variable( const std::string &type );
 
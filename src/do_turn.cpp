@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "action.h"
+#include "async_save.h"
 #include "activity_type.h"
 #include "avatar.h"
 #include "bionics.h"
@@ -102,6 +103,8 @@ namespace turn_handler
 {
 bool cleanup_at_end()
 {
+    // Finish writing any quicksave before the save files are moved or deleted.
+    async_save::wait_all();
     avatar &u = get_avatar();
     if( g->uquit == QUIT_DIED || g->uquit == QUIT_SUICIDE ) {
         // Put (non-hallucinations) into the overmap so they are not lost.
@@ -517,6 +520,7 @@ bool do_turn()
 
     u.update_body();
 
+    g->report_finished_saves();
     // Auto-save if autosave is enabled
     if( get_option<bool>( "AUTOSAVE" ) &&
         calendar::once_every( 1_turns * get_option<int>( "AUTOSAVE_TURNS" ) ) &&
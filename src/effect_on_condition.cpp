@@ -2,10 +2,14 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <list>
+#include <map>
+#include <optional>
 #include <ostream>
-#include <queue>
 #include <set>
+#include <vector>
 
 #include "avatar.h"
 #include "calendar.h"
@@ -132,6 +136,195 @@ effect_on_condition_id effect_on_conditions::load_inline_eoc( const JsonValue &j
     }
 }
 
+queued_eocs::queued_eocs( const queued_eocs &rhs ) : list( rhs.list ), cursor( rhs.cursor )
+{
+    rebuild();
+}
+
+queued_eocs &queued_eocs::operator=( const queued_eocs &rhs )
+{
+    list = rhs.list;
+    cursor = rhs.cursor;
+    held = 0;
+    rebuild();
+    return *this;
+}
+
+void queued_eocs::push( const queued_eoc &eoc )
+{
+    schedule( list.emplace( list.end(), eoc ) );
+}
+
+void queued_eocs::clear()
+{
+    list.clear();
+    held = 0;
+    rebuild();
+}
+
+void queued_eocs::remove_if( const std::function<bool( const queued_eoc & )> &pred )
+{
+    const auto remove = [this, &pred]( std::vector<storage_iter> &bucket ) {
+        bucket.erase( std::remove_if( bucket.begin(), bucket.end(), [this, &pred]( storage_iter it ) {
+            if( pred( *it ) ) {
+                list.erase( it );
+                return true;
+            }
+            return false;
+        } ), bucket.end() );
+    };
+    due.erase( due.begin(), due.begin() + due_next );
+    due_next = 0;
+    remove( due );
+    remove( overflow );
+    for( int level = 0; level < levels; ++level ) {
+        for( std::int64_t idx = 0; idx <= slot_mask; ++idx ) {
+            const std::uint64_t bit = std::uint64_t{ 1 } << idx;
+            if( !( occupied[level] & bit ) ) {
+                continue;
+            }
+            std::vector<storage_iter> &slot = slots[( level << bits ) + idx];
+            remove( slot );
+            if( slot.empty() ) {
+                occupied[level] &= ~bit;
+            }
+        }
+    }
+}
+
+std::optional<queued_eocs::storage_iter> queued_eocs::pop_due( const time_point &now )
+{
+    const std::int64_t turn = to_turn<int>( now );
+    if( turn + 1 < cursor && held == 0 ) {
+        // time went backwards (debug menu, tests), lay the schedule out again from here
+        cursor = turn + 1;
+        rebuild();
+    }
+    if( due_next == due.size() ) {
+        due.clear();
+        due_next = 0;
+        advance( turn );
+        if( due.empty() ) {
+            return std::nullopt;
+        }
+    }
+    ++held;
+    return due[due_next++];
+}
+
+void queued_eocs::reschedule( storage_iter it )
+{
+    --held;
+    schedule( it );
+}
+
+void queued_eocs::discard( storage_iter it )
+{
+    --held;
+    list.erase( it );
+}
+
+void queued_eocs::schedule( storage_iter it )
+{
+    const std::int64_t turn = to_turn<int>( it->time );
+    if( turn < cursor ) {
+        due.emplace_back( it );
+        return;
+    }
+    // the entry goes on the lowest level whose current revolution contains its turn
+    for( int level = 0; level < levels; ++level ) {
+        const int shift = bits * ( level + 1 );
+        if( ( turn >> shift ) == ( cursor >> shift ) ) {
+            const std::int64_t idx = ( turn >> ( bits * level ) ) & slot_mask;
+            if( slots.empty() ) {
+                slots.resize( levels << bits );
+            }
+            slots[( level << bits ) + idx].emplace_back( it );
+            occupied[level] |= std::uint64_t{ 1 } << idx;
+            return;
+        }
+    }
+    overflow.emplace_back( it );
+}
+
+void queued_eocs::advance( std::int64_t now )
+{
+    while( cursor <= now ) {
+        int empty_levels = 0;
+        while( empty_levels < levels && occupied[empty_levels] == 0 ) {
+            ++empty_levels;
+        }
+        if( empty_levels == 0 ) {
+            // collect the single-turn slots up to the end of this revolution
+            const std::int64_t stop = std::min( now, cursor | slot_mask );
+            for( std::int64_t turn = cursor; turn <= stop; ++turn ) {
+                const std::uint64_t bit = std::uint64_t{ 1 } << ( turn & slot_mask );
+                if( occupied[0] & bit ) {
+                    std::vector<storage_iter> &slot = slots[turn & slot_mask];
+                    due.insert( due.end(), slot.begin(), slot.end() );
+                    slot.clear();
+                    occupied[0] &= ~bit;
+                }
+            }
+            cursor = stop + 1;
+        } else if( empty_levels == levels && overflow.empty() ) {
+            cursor = now + 1;
+            return;
+        } else {
+            // nothing is due before the lowest occupied level next cascades
+            const int shift = bits * empty_levels;
+            cursor = std::min( ( ( cursor >> shift ) + 1 ) << shift, now + 1 );
+        }
+        if( ( cursor & slot_mask ) == 0 ) {
+            cascade();
+        }
+    }
+}
+
+void queued_eocs::cascade()
+{
+    // the highest level whose revolution the cursor just completed
+    int top = 1;
+    while( top < levels && cursor % ( std::int64_t{ 1 } << ( bits * ( top + 1 ) ) ) == 0 ) {
+        ++top;
+    }
+    std::vector<storage_iter> moving;
+    if( top == levels ) {
+        moving.swap( overflow );
+        for( storage_iter it : moving ) {
+            schedule( it );
+        }
+        moving.clear();
+        --top;
+    }
+    // spread the slot the cursor entered on each level over the levels below it
+    for( int level = top; level > 0; --level ) {
+        const std::int64_t idx = ( cursor >> ( bits * level ) ) & slot_mask;
+        const std::uint64_t bit = std::uint64_t{ 1 } << idx;
+        if( !( occupied[level] & bit ) ) {
+            continue;
+        }
+        moving.swap( slots[( level << bits ) + idx] );
+        occupied[level] &= ~bit;
+        for( storage_iter it : moving ) {
+            schedule( it );
+        }
+        moving.clear();
+    }
+}
+
+void queued_eocs::rebuild()
+{
+    slots.clear();
+    occupied = {};
+    overflow.clear();
+    due.clear();
+    due_next = 0;
+    for( auto it = list.begin(); it != list.end(); ++it ) {
+        schedule( it );
+    }
+}
+
 static time_duration next_recurrence( const effect_on_condition_id &eoc, dialogue &d )
 {
     return eoc->recurrence.evaluate( d );
@@ -166,18 +359,14 @@ static void process_new_eocs( queued_eocs &eoc_queue,
                               std::vector<effect_on_condition_id> &eoc_vector,
                               std::map<effect_on_condition_id, bool> &new_eocs, bool global_queue )
 {
-    queued_eocs temp_queued_eocs;
-    while( !eoc_queue.empty() ) {
+    eoc_queue.remove_if( [&new_eocs, global_queue]( const queued_eoc & queued ) {
         // Check if EoC is moved from global to local, or vice versa
-        if( global_queue == eoc_queue.top().eoc->global ) {
-            if( eoc_queue.top().eoc.is_valid() ) {
-                temp_queued_eocs.push( eoc_queue.top() );
-            }
-            new_eocs[eoc_queue.top().eoc] = false;
+        if( global_queue != queued.eoc->global ) {
+            return true;
         }
-        eoc_queue.pop();
-    }
-    eoc_queue = std::move( temp_queued_eocs );
+        new_eocs[queued.eoc] = false;
+        return !queued.eoc.is_valid();
+    } );
     for( auto eoc = eoc_vector.begin();
          eoc != eoc_vector.end(); ) {
         // Check if EoC is moved from global to local, or vice versa
@@ -235,11 +424,9 @@ static void process_eocs( queued_eocs &eoc_queue, std::vector<effect_on_conditio
     static std::vector<queued_eocs::storage_iter> eocs_to_queue;
     eocs_to_queue.clear();
 
-    while( !eoc_queue.empty() &&
-           eoc_queue.top().time <= calendar::turn ) {
-        queued_eocs::storage_iter it = eoc_queue.queue.top();
+    while( std::optional<queued_eocs::storage_iter> due = eoc_queue.pop_due( calendar::turn ) ) {
+        queued_eocs::storage_iter it = *due;
         queued_eoc &top = *it;
-        eoc_queue.queue.pop();
 
         dialogue nested_d{ d };
         for( const auto &val : top.context ) {
@@ -257,15 +444,15 @@ static void process_eocs( queued_eocs &eoc_queue, std::vector<effect_on_conditio
                     eocs_to_queue.emplace_back( it );
                 } else { // It failed and should be deactivated for now
                     eoc_vector.push_back( top.eoc );
-                    eoc_queue.list.erase( it );
+                    eoc_queue.discard( it );
                 }
             }
         } else {
-            eoc_queue.list.erase( it );
+            eoc_queue.discard( it );
         }
     }
     for( queued_eocs::storage_iter &q_eoc : eocs_to_queue ) {
-        eoc_queue.queue.emplace( q_eoc );
+        eoc_queue.reschedule( q_eoc );
     }
 }
 
@@ -366,13 +553,9 @@ void effect_on_condition::apply_true_effects( dialogue &d )  const
 
 void effect_on_conditions::clear( Character &you )
 {
-    while( !you.queued_effect_on_conditions.empty() ) {
-        you.queued_effect_on_conditions.pop();
-    }
+    you.queued_effect_on_conditions.clear();
     you.inactive_effect_on_condition_vector.clear();
-    while( !g->queued_global_effect_on_conditions.empty() ) {
-        g->queued_global_effect_on_conditions.pop();
-    }
+    g->queued_global_effect_on_conditions.clear();
     g->inactive_global_effect_on_condition_vector.clear();
 }
 
@@ -383,21 +566,11 @@ void effect_on_conditions::write_eocs_to_file( Character &you )
         testfile << "id;timepoint;recurring" << std::endl;
 
         testfile << "queued eocs:" << std::endl;
-        std::vector<queued_eoc> temp_queue;
-        while( !you.queued_effect_on_conditions.empty() ) {
-            temp_queue.push_back( you.queued_effect_on_conditions.top() );
-            you.queued_effect_on_conditions.pop();
-        }
-
-        for( const queued_eoc &queue_entry : temp_queue ) {
+        for( const queued_eoc &queue_entry : you.queued_effect_on_conditions.list ) {
             time_duration temp = queue_entry.time - calendar::turn;
             testfile << queue_entry.eoc.c_str() << ";" << to_string( temp ) << std::endl;
         }
 
-        for( const queued_eoc &queued : temp_queue ) {
-            you.queued_effect_on_conditions.push( queued );
-        }
-
         testfile << "inactive eocs:" << std::endl;
         for( const effect_on_condition_id &eoc : you.inactive_effect_on_condition_vector ) {
             testfile << eoc.c_str() << std::endl;
@@ -413,21 +586,11 @@ void effect_on_conditions::write_global_eocs_to_file( )
         testfile << "id;timepoint;recurring" << std::endl;
 
         testfile << "queued eocs:" << std::endl;
-        std::vector<queued_eoc> temp_queue;
-        while( !g->queued_global_effect_on_conditions.empty() ) {
-            temp_queue.push_back( g->queued_global_effect_on_conditions.top() );
-            g->queued_global_effect_on_conditions.pop();
-        }
-
-        for( const queued_eoc &queue_entry : temp_queue ) {
+        for( const queued_eoc &queue_entry : g->queued_global_effect_on_conditions.list ) {
             time_duration temp = queue_entry.time - calendar::turn;
             testfile << queue_entry.eoc.c_str() << ";" << to_string( temp ) << std::endl;
         }
 
-        for( const queued_eoc &queued : temp_queue ) {
-            g->queued_global_effect_on_conditions.push( queued );
-        }
-
         testfile << "inactive eocs:" << std::endl;
         for( const effect_on_condition_id &eoc : g->inactive_global_effect_on_condition_vector ) {
             testfile << eoc.c_str() << std::endl;
@@ -16,6 +16,7 @@
 #include <emscripten.h>
 #endif
 
+#include "async_save.h"
 #include "cata_utility.h"
 #include "debug.h"
 
@@ -119,12 +120,14 @@ bool file_exist( const std::string &path )
 
 bool file_exist( const fs::path &path )
 {
+    async_save::wait_for( path );
     return fs::exists( path ) && !fs::is_directory( path );
 }
 
 bool file_exist( const cata_path &path )
 {
     const fs::path unrelative_path = path.get_unrelative_path();
+    async_save::wait_for( unrelative_path );
     return fs::exists( unrelative_path ) && !fs::is_directory( unrelative_path );
 }
 
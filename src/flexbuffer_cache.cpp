@@ -409,7 +409,19 @@ std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse( fs::path json_source
 
     const char *json_text = reinterpret_cast<const char *>( json_source->base ) + offset;
 
-    std::vector<uint8_t> fb = parse_json_to_flexbuffer_( json_text, json_source_path_string.c_str() );
+    const char *file_start = reinterpret_cast<const char *>( json_source->base );
+    std::vector<uint8_t> fb;
+    if( json_source->len >= 2 && file_start[0] == '\x1f' && file_start[1] == '\x8b' ) {
+        // A compressed save file, inflate it first
+        std::optional<std::string> json_file_contents = read_whole_file( json_source_path );
+        if( !json_file_contents.has_value() || json_file_contents->empty() ) {
+            throw std::runtime_error( "Failed to read " + json_source_path_string );
+        }
+        fb = parse_json_to_flexbuffer_( json_file_contents->c_str() + offset,
+                                        json_source_path_string.c_str() );
+    } else {
+        fb = parse_json_to_flexbuffer_( json_text, json_source_path_string.c_str() );
+    }
 
     auto storage = std::make_shared<flexbuffer_vector_storage>( std::move( fb ) );
 
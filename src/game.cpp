@@ -42,6 +42,7 @@
 #include "activity_handlers.h"
 #include "activity_type.h"
 #include "ascii_art.h"
+#include "async_save.h"
 #include "auto_note.h"
 #include "auto_pickup.h"
 #include "avatar.h"
@@ -3423,6 +3424,8 @@ spell_events &game::spell_events_subscriber()
 
 bool game::save()
 {
+    // Let a previous background save finish so the two don't interleave.
+    async_save::wait_all();
     std::chrono::seconds time_since_load =
         std::chrono::duration_cast<std::chrono::seconds>(
             std::chrono::steady_clock::now() - time_of_last_load );
@@ -12807,8 +12810,12 @@ void game::quicksave()
 
     time_t now = std::time( nullptr ); //timestamp for start of saving procedure
 
-    //perform save
-    save();
+    //perform save; the game state is serialized now, but the files are written in the
+    //background and the outcome is reported by report_finished_saves()
+    {
+        async_save::batch background;
+        save();
+    }
     //Now reset counters for autosaving, so we don't immediately autosave after a quicksave or autosave.
     moves_since_last_save = 0;
     last_save_timestamp = now;
@@ -12841,6 +12848,24 @@ void game::quickload()
     }
 }
 
+void game::report_finished_saves()
+{
+    for( const async_save::report &r : async_save::finished() ) {
+        if( r.errors.empty() ) {
+            add_msg( m_info, _( "Game saved." ) );
+            continue;
+        }
+        for( const std::string &err : r.errors ) {
+            if( test_mode ) {
+                DebugLog( D_ERROR, DC_ALL ) << err;
+            } else {
+                popup( "%s", err );
+            }
+        }
+        add_msg( m_bad, _( "The game could not be saved." ) );
+    }
+}
+
 void game::autosave()
 {
     //Don't autosave if the min-autosave interval has not passed since the last autosave/quicksave.
@@ -1032,6 +1032,8 @@ class game
 
         //  int autosave_timeout();  // If autosave enabled, how long we should wait for user inaction before saving.
         void autosave();         // automatic quicksaves - Performs some checks before calling quicksave()
+        // Reports the outcome of quicksaves whose files finished writing in the background
+        void report_finished_saves();
     public:
         void quicksave();        // Saves the game without quitting
         void quickload();        // Loads the previously saved game if it exists
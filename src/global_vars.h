@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "json.h"
+#include "var_value.h"
 
 enum class var_type : int {
     u,
@@ -21,23 +22,32 @@ class global_variables
     public:
         // Methods for setting/getting misc key/value pairs.
         void set_global_value( const std::string &key, const std::string &value ) {
-            global_values[ key ] = value;
+            global_values[ key ] = var_value( value );
+        }
+
+        void set_global_value( const std::string &key, double value ) {
+            global_values[ key ] = var_value( value );
         }
 
         void remove_global_value( const std::string &key ) {
             global_values.erase( key );
         }
 
-        std::optional<std::string> maybe_get_global_value( const std::string &key ) const {
+        const var_value *find_global_value( const std::string &key ) const {
             auto it = global_values.find( key );
-            return it == global_values.end() ? std::nullopt : std::optional<std::string> { it->second };
+            return it == global_values.end() ? nullptr : &it->second;
+        }
+
+        std::optional<std::string> maybe_get_global_value( const std::string &key ) const {
+            const var_value *val = find_global_value( key );
+            return val == nullptr ? std::nullopt : std::optional<std::string> { val->get_str() };
         }
 
         std::string get_global_value( const std::string &key ) const {
             return maybe_get_global_value( key ).value_or( std::string{} );
         }
 
-        std::unordered_map<std::string, std::string> get_global_values() const {
+        const std::unordered_map<std::string, var_value> &get_global_values() const {
             return global_values;
         }
 
@@ -45,7 +55,7 @@ class global_variables
             global_values.clear();
         }
 
-        void set_global_values( std::unordered_map<std::string, std::string> input ) {
+        void set_global_values( std::unordered_map<std::string, var_value> input ) {
             global_values = std::move( input );
         }
         void unserialize( JsonObject &jo );
@@ -55,7 +65,7 @@ class global_variables
         static void load_migrations( const JsonObject &jo, const std::string_view &src );
 
     private:
-        std::unordered_map<std::string, std::string> global_values;
+        std::unordered_map<std::string, var_value> global_values;
 };
 global_variables &get_globals();
 
@@ -0,0 +1,36 @@
+#pragma once
+#ifndef CATA_SRC_GZIP_STREAM_H
+#define CATA_SRC_GZIP_STREAM_H
+
+#include <memory>
+#include <ostream>
+
+/**
+ * Output stream that gzip compresses everything written to it and passes the compressed
+ * data on to another stream as it goes, so the uncompressed data is never held in memory
+ * as a whole.
+ *
+ * The output starts with the gzip magic bytes, @ref read_maybe_compressed_file and the
+ * other read functions in cata_utility.h recognize it and inflate it transparently.
+ *
+ * Call @ref finish to flush the compressor and write the gzip trailer. It throws if
+ * compressing or writing to the target stream failed. The destructor finishes the stream
+ * as well, but ignores any errors.
+ */
+class gzip_ostream : public std::ostream
+{
+    public:
+        /** Save files are mostly JSON, the fastest level already shrinks them a lot. */
+        static constexpr int default_level = 1;
+
+        explicit gzip_ostream( std::ostream &target, int level = default_level );
+        ~gzip_ostream() override;
+
+        void finish();
+
+    private:
+        class buffer;
+        std::unique_ptr<buffer> buf;
+};
+
+#endif // CATA_SRC_GZIP_STREAM_H
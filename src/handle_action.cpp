@@ -425,14 +425,25 @@ input_context game::get_player_input( std::string &action )
             }
 
             ui_manager::redraw_invalidated();
+
+            // Mapgen would stall the animations, and there is no point in it once the game is over
+            if( action == "TIMEOUT" && uquit != QUIT_WATCH && !bWeatherEffect && SCT.vSCT.empty() &&
+                !g->has_blink_curses() ) {
+                m.pregenerate_next();
+            }
         } while( handle_mouseview( ctxt, action ) && uquit != QUIT_WATCH
                  && ( action != "TIMEOUT" || !current_turn.has_timeout_elapsed() ) );
         ctxt.reset_timeout();
     } else {
         ctxt.set_timeout( 125 );
         while( handle_mouseview( ctxt, action ) ) {
-            if( action == "TIMEOUT" && current_turn.has_timeout_elapsed() ) {
-                break;
+            if( action == "TIMEOUT" ) {
+                if( current_turn.has_timeout_elapsed() ) {
+                    break;
+                }
+                if( uquit != QUIT_WATCH ) {
+                    m.pregenerate_next();
+                }
             }
         }
         ctxt.reset_timeout();
@@ -631,9 +631,9 @@ item item::make_corpse( const mtype_id &mt, time_point turn, const std::string &
         result.set_var( "zombie_form", mt->zombify_into.c_str() );
     }
 
-    // This is unconditional because the const itemructor above sets result.name to
-    // "human corpse".
-    result.corpse_name = name;
+    if( !name.empty() ) {
+        result.edit_cold().corpse_name = name;
+    }
 
     return result;
 }
@@ -1702,16 +1702,20 @@ stacking_info item::stacks_with( const item &rhs, bool check_components, bool co
     bits.set( tname::segments::CUSTOM_ITEM_SUFFIX, bits[tname::segments::TAGS] );
 
     bits.set( tname::segments::FAULTS, faults == rhs.faults );
-    bits.set( tname::segments::TECHNIQUES, techniques == rhs.techniques );
+    bits.set( tname::segments::TECHNIQUES, cold().techniques == rhs.cold().techniques );
     bits.set( tname::segments::OVERHEAT, overheat_symbol() == rhs.overheat_symbol() );
-    bits.set( tname::segments::DIRT, get_var( "dirt", 0 ) == rhs.get_var( "dirt", 0 ) );
+    static const item_var_key var_dirt( "dirt" );
+    bits.set( tname::segments::DIRT, get_var( var_dirt, 0 ) == rhs.get_var( var_dirt, 0 ) );
     bits.set( tname::segments::SEALED, all_pockets_sealed() == rhs.all_pockets_sealed() );
     bits.set( tname::segments::CBM_STATUS, _stacks_cbm_status( *this, rhs ) );
     bits.set( tname::segments::BROKEN, is_broken() == rhs.is_broken() );
     bits.set( tname::segments::UPS, _stacks_ups( *this, rhs ) );
     // Guns that differ only by dirt/shot_counter can still stack,
     // but other item_vars such as label/note will prevent stacking
-    static const std::set<std::string> ignore_keys = { "dirt", "shot_counter", "spawn_location_omt", "ethereal" };
+    static const std::set<item_var_key> ignore_keys = {
+        item_var_key( "dirt" ), item_var_key( "shot_counter" ),
+        item_var_key( "spawn_location_omt" ), item_var_key( "ethereal" )
+    };
     bits.set( tname::segments::VARS, map_equal_ignoring_keys( item_vars, rhs.item_vars, ignore_keys ) );
     bits.set( tname::segments::ETHEREAL, _stacks_ethereal( *this, rhs ) );
     bits.set( tname::segments::LOCATION_HINT, _stacks_location_hint( *this, rhs ) );
@@ -1736,7 +1740,7 @@ stacking_info item::stacks_with( const item &rhs, bool check_components, bool co
     bits.set( tname::segments::CORPSE,
               ( corpse == nullptr && rhs.corpse == nullptr ) ||
               ( corpse != nullptr && rhs.corpse != nullptr && corpse->id == rhs.corpse->id &&
-                corpse_name == rhs.corpse_name ) );
+                cold().corpse_name == rhs.cold().corpse_name ) );
     bits.set( tname::segments::FOOD_PERISHABLE, _stacks_food_perishable( *this, rhs, check_cat ) );
     bits.set( tname::segments::CLOTHING_SIZE, _stacks_clothing_size( *this, rhs ) );
     bits.set( tname::segments::BROKEN, is_broken() == rhs.is_broken() );
@@ -1821,41 +1825,35 @@ void item::force_insert_item( const item &it, pocket_type pk_type )
 
 void item::set_var( const std::string &name, const int value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( name, item_var_value( static_cast<long long>( value ) ) );
 }
 
 void item::set_var( const std::string &name, const long long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( name, item_var_value( static_cast<long long>( value ) ) );
 }
 
 // NOLINTNEXTLINE(cata-no-long)
 void item::set_var( const std::string &name, const long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( name, item_var_value( static_cast<long long>( value ) ) );
 }
 
 void item::set_var( const std::string &name, const double value )
 {
-    item_vars[name] = string_format( "%f", value );
+    item_vars.set( name, item_var_value( value ) );
 }
 
-double item::get_var( const std::string &name, const double default_value ) const
+static double get_var_number( const item_var_map &vars, const item_var_map::const_iterator it,
+                              const double default_value )
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
+    if( it == vars.end() ) {
         return default_value;
     }
-    const std::string &val = it->second;
+    if( const std::optional<double> number = it->second.number() ) {
+        return *number;
+    }
+    const std::string &val = *it->second.text();
     char *end;
     errno = 0;
     double result = strtod( val.data(), &end );
@@ -1886,9 +1884,19 @@ double item::get_var( const std::string &name, const double default_value ) cons
     return result;
 }
 
+double item::get_var( const std::string &name, const double default_value ) const
+{
+    return get_var_number( item_vars, item_vars.find( name ), default_value );
+}
+
+double item::get_var( const item_var_key &name, const double default_value ) const
+{
+    return get_var_number( item_vars, item_vars.find( name ), default_value );
+}
+
 void item::set_var( const std::string &name, const tripoint &value )
 {
-    item_vars[name] = string_format( "%d,%d,%d", value.x, value.y, value.z );
+    item_vars.set( name, item_var_value( string_format( "%d,%d,%d", value.x, value.y, value.z ) ) );
 }
 
 tripoint item::get_var( const std::string &name, const tripoint &default_value ) const
@@ -1897,7 +1905,7 @@ tripoint item::get_var( const std::string &name, const tripoint &default_value )
     if( it == item_vars.end() ) {
         return default_value;
     }
-    std::vector<std::string> values = string_split( it->second, ',' );
+    std::vector<std::string> values = string_split( it->second.str(), ',' );
     cata_assert( values.size() == 3 );
     auto convert_or_error = []( const std::string_view s ) {
         ret_val<int> result = try_parse_integer<int>( s, false );
@@ -1915,7 +1923,7 @@ tripoint item::get_var( const std::string &name, const tripoint &default_value )
 
 void item::set_var( const std::string &name, const std::string &value )
 {
-    item_vars[name] = value;
+    item_vars.set( name, item_var_value( value ) );
 }
 
 std::string item::get_var( const std::string &name, const std::string &default_value ) const
@@ -1924,7 +1932,7 @@ std::string item::get_var( const std::string &name, const std::string &default_v
     if( it == item_vars.end() ) {
         return default_value;
     }
-    return it->second;
+    return it->second.str();
 }
 
 std::string item::get_var( const std::string &name ) const
@@ -1935,7 +1943,7 @@ std::string item::get_var( const std::string &name ) const
 std::optional<std::string> item::maybe_get_var( const std::string &name ) const
 {
     const auto it = item_vars.find( name );
-    return it == item_vars.end() ? std::nullopt : std::optional<std::string> { it->second };
+    return it == item_vars.end() ? std::nullopt : std::optional<std::string> { it->second.str() };
 }
 
 bool item::has_var( const std::string &name ) const
@@ -1943,6 +1951,11 @@ bool item::has_var( const std::string &name ) const
     return item_vars.count( name ) > 0;
 }
 
+bool item::has_var( const item_var_key &name ) const
+{
+    return item_vars.find( name ) != item_vars.end();
+}
+
 void item::erase_var( const std::string &name )
 {
     item_vars.erase( name );
@@ -2191,7 +2204,7 @@ std::string item::get_owner_name() const
 void item::set_owner( const faction_id &new_owner )
 {
     owner = new_owner;
-    for( item *e : contents.all_items_top() ) {
+    for( item *e : contents.top_items() ) {
         e->set_owner( new_owner );
     }
 }
@@ -2445,8 +2458,7 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
 
     if( parts->test( iteminfo_parts::DESCRIPTION ) ) {
         insert_separation_line( info );
-        const std::map<std::string, std::string>::const_iterator idescription =
-            item_vars.find( "description" );
+        const item_var_map::const_iterator idescription = item_vars.find( "description" );
         const std::optional<translation> snippet = SNIPPET.get_snippet_by_id( snip_id );
         if( snippet.has_value() ) {
             // Just use the dynamic description
@@ -2466,7 +2478,7 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
                 get_avatar().add_snippet( snip_id );
             }
         } else if( idescription != item_vars.end() ) {
-            info.emplace_back( "DESCRIPTION", idescription->second );
+            info.emplace_back( "DESCRIPTION", idescription->second.str() );
         } else if( has_itype_variant() ) {
             info.emplace_back( "DESCRIPTION", variant_description() );
         } else {
@@ -2573,8 +2585,8 @@ void item::debug_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
             info.emplace_back( "BASE", string_format( _( "flags: %s" ), flags_listed ) );
             for( auto const &imap : item_vars ) {
                 info.emplace_back( "BASE",
-                                   string_format( _( "item var: %s, %s" ), imap.first,
-                                                  imap.second ) );
+                                   string_format( _( "item var: %s, %s" ), imap.first.str(),
+                                                  imap.second.str() ) );
             }
 
             info.emplace_back( "BASE", _( "wetness: " ),
@@ -5336,7 +5348,7 @@ void item::qualities_info( std::vector<iteminfo> &info, const iteminfo_query *pa
 
         info.emplace_back( "QUALITIES", "", _( "Contains items with qualities:" ) );
         std::map<quality_id, int, quality_id::LexCmp> most_quality;
-        for( const item *e : contents.all_items_top() ) {
+        for( const item *e : contents.top_items() ) {
             for( const std::pair<const quality_id, int> &q : e->type->qualities ) {
                 auto emplace_result = most_quality.emplace( q );
                 if( !emplace_result.second &&
@@ -5545,7 +5557,7 @@ void item::melee_combat_info( std::vector<iteminfo> &info, const iteminfo_query
 
     if( parts->test( iteminfo_parts::DESCRIPTION_TECHNIQUES ) ) {
         std::set<matec_id> all_techniques = type->techniques;
-        all_techniques.insert( techniques.begin(), techniques.end() );
+        all_techniques.insert( cold().techniques.begin(), cold().techniques.end() );
 
         if( !all_techniques.empty() ) {
             const std::vector<matec_id> all_tec_sorted = sorted_lex( all_techniques );
@@ -5665,7 +5677,7 @@ void item::contents_info( std::vector<iteminfo> &info, const iteminfo_query *par
         info.emplace_back( "DESCRIPTION", mod->type->description.translated() );
     }
     bool contents_header = false;
-    for( const item *contents_item : contents.all_items_top() ) {
+    for( const item *contents_item : contents.top_items() ) {
         if( !contents_header ) {
             insert_separation_line( info );
             info.emplace_back( "DESCRIPTION", _( "<bold>Contents of this item</bold>:" ) );
@@ -5738,7 +5750,7 @@ void item::properties_info( std::vector<iteminfo> &info, const iteminfo_query *p
         cata::flat_set<flag_id> flags;
         flags.insert( get_flags().begin(), get_flags().end() );
         flags.insert( type->get_flags().begin(), type->get_flags().end() );
-        flags.insert( inherited_tags_cache.begin(), inherited_tags_cache.end() );
+        flags.insert( cold().inherited_tags_cache.begin(), cold().inherited_tags_cache.end() );
 
         // ...and display those which have an info description
         for( const flag_id &e : sorted_lex( flags ) ) {
@@ -5985,27 +5997,26 @@ void item::final_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
         }
     }
 
-    std::map<std::string, std::string>::const_iterator item_note = item_vars.find( "item_note" );
+    const item_var_map::const_iterator item_note = item_vars.find( "item_note" );
 
     if( item_note != item_vars.end() && parts->test( iteminfo_parts::DESCRIPTION_NOTES ) ) {
         insert_separation_line( info );
         std::string ntext;
-        std::map<std::string, std::string>::const_iterator item_note_tool =
-            item_vars.find( "item_note_tool" );
+        const item_var_map::const_iterator item_note_tool = item_vars.find( "item_note_tool" );
         const use_function *use_func =
             item_note_tool != item_vars.end() ?
             item_controller->find_template(
-                itype_id( item_note_tool->second ) )->get_use( "inscribe" ) :
+                itype_id( item_note_tool->second.str() ) )->get_use( "inscribe" ) :
             nullptr;
         const inscribe_actor *use_actor =
             use_func ? dynamic_cast<const inscribe_actor *>( use_func->get_actor_ptr() ) : nullptr;
         if( use_actor ) {
             //~ %1$s: gerund (e.g. carved), %2$s: item name, %3$s: inscription text
             ntext = string_format( pgettext( "carving", "%1$s on the %2$s is: %3$s" ),
-                                   use_actor->gerund, tname(), item_note->second );
+                                   use_actor->gerund, tname(), item_note->second.str() );
         } else {
             //~ %1$s: inscription text
-            ntext = string_format( pgettext( "carving", "Note: %1$s" ), item_note->second );
+            ntext = string_format( pgettext( "carving", "Note: %1$s" ), item_note->second.str() );
         }
         info.emplace_back( "DESCRIPTION", ntext );
     }
@@ -6285,7 +6296,7 @@ int item::get_free_mod_locations( const gunmod_location &location ) const
         return 0;
     }
     int result = loc->second;
-    for( const item *elem : contents.all_items_top( pocket_type::MOD ) ) {
+    for( const item *elem : contents.top_items( pocket_type::MOD ) ) {
         const cata::value_ptr<islot_gunmod> &mod = elem->type->gunmod;
         if( mod && mod->location == location ) {
             result--;
@@ -6673,12 +6684,12 @@ void item::on_pickup( Character &p )
 
 void item::update_inherited_flags()
 {
-    inherited_tags_cache.clear();
+    FlagsSetType inherited_tags;
 
-    auto const inehrit_flags = [this]( FlagsSetType const & Flags ) {
+    auto const inehrit_flags = [&inherited_tags]( FlagsSetType const & Flags ) {
         for( flag_id const &f : Flags ) {
             if( f->inherit() ) {
-                inherited_tags_cache.emplace( f );
+                inherited_tags.emplace( f );
             }
         }
     };
@@ -6693,19 +6704,24 @@ void item::update_inherited_flags()
 
     for( const item_pocket *pocket : contents.get_all_contained_pockets() ) {
         if( pocket->inherits_flags() ) {
-            for( const item *e : pocket->all_items_top() ) {
+            for( const item *e : pocket->top_items() ) {
                 inehrit_flags( e->get_flags() );
                 inehrit_flags( e->type->get_flags() );
             }
         }
     }
+    if( cold_ || !inherited_tags.empty() ) {
+        edit_cold().inherited_tags_cache = std::move( inherited_tags );
+    }
     update_prefix_suffix_flags();
 }
 
 void item::update_prefix_suffix_flags()
 {
-    prefix_tags_cache.clear();
-    suffix_tags_cache.clear();
+    if( cold_ ) {
+        cold_->prefix_tags_cache.clear();
+        cold_->suffix_tags_cache.clear();
+    }
     auto const insert_prefix_suffix_flags = [this]( FlagsSetType const & Flags ) {
         for( flag_id const &f : Flags ) {
             update_prefix_suffix_flags( f );
@@ -6713,17 +6729,33 @@ void item::update_prefix_suffix_flags()
     };
     insert_prefix_suffix_flags( get_flags() );
     insert_prefix_suffix_flags( type->get_flags() );
-    insert_prefix_suffix_flags( inherited_tags_cache );
+    if( cold_ ) {
+        insert_prefix_suffix_flags( cold_->inherited_tags_cache );
+    }
 }
 
 void item::update_prefix_suffix_flags( const flag_id &f )
 {
     if( !f->item_prefix().empty() ) {
-        prefix_tags_cache.emplace( f );
+        edit_cold().prefix_tags_cache.emplace( f );
     }
     if( !f->item_suffix().empty() ) {
-        suffix_tags_cache.emplace( f );
+        edit_cold().suffix_tags_cache.emplace( f );
+    }
+}
+
+const item::cold_data &item::cold() const
+{
+    static const cold_data no_cold_data;
+    return cold_ ? *cold_ : no_cold_data;
+}
+
+item::cold_data &item::edit_cold()
+{
+    if( !cold_ ) {
+        cold_ = cata::make_value<cold_data>();
     }
+    return *cold_;
 }
 
 void item::on_contents_changed()
@@ -7086,6 +7118,36 @@ int item::price_no_contents( bool practical, std::optional<int> price_override )
     return price;
 }
 
+size_t item::memory_usage() const
+{
+    size_t bytes = sizeof( item );
+    // item_tags and faults are always allocated, see cata::heap
+    bytes += sizeof( FlagsSetType ) + tree_heap_bytes<flag_id>( item_tags.size() );
+    bytes += sizeof( std::set<fault_id> ) + tree_heap_bytes<fault_id>( faults.size() );
+    bytes += item_vars.memory_usage();
+    if( cold_ ) {
+        bytes += sizeof( cold_data ) +
+                 tree_heap_bytes<flag_id>( cold_->inherited_tags_cache.size() +
+                                           cold_->prefix_tags_cache.size() + cold_->suffix_tags_cache.size() ) +
+                 tree_heap_bytes<matec_id>( cold_->techniques.size() ) +
+                 string_heap_bytes( cold_->corpse_name );
+    }
+    if( craft_data_ ) {
+        bytes += sizeof( craft_data ) +
+                 craft_data_->comps_used.capacity() * sizeof( item_comp ) +
+                 craft_data_->cached_tool_selections.capacity() * sizeof( comp_selection<tool_comp> );
+    }
+    if( relic_data ) {
+        bytes += sizeof( relic );
+    }
+    if( link_ ) {
+        bytes += sizeof( link_data );
+    }
+    bytes += components.memory_usage();
+    bytes += contents.memory_usage();
+    return bytes;
+}
+
 // TODO: MATERIALS add a density field to materials.json
 units::mass item::weight( bool include_contents, bool integral ) const
 {
@@ -7592,7 +7654,7 @@ bool item::has_flag( const flag_id &f ) const
         return false;
     }
 
-    ret = inherited_tags_cache.find( f ) != inherited_tags_cache.end();
+    ret = cold_ && cold_->inherited_tags_cache.count( f ) > 0;
     if( ret ) {
         return ret;
     }
@@ -7673,12 +7735,12 @@ const item::FlagsSetType &item::get_flags() const
 
 const item::FlagsSetType &item::get_prefix_flags() const
 {
-    return prefix_tags_cache;
+    return cold().prefix_tags_cache;
 }
 
 const item::FlagsSetType &item::get_suffix_flags() const
 {
-    return suffix_tags_cache;
+    return cold().suffix_tags_cache;
 }
 
 bool item::has_property( const std::string &prop ) const
@@ -7763,19 +7825,19 @@ int item::get_quality( const quality_id &id, const bool strict_boiling ) const
 
 bool item::has_technique( const matec_id &tech ) const
 {
-    return type->techniques.count( tech ) > 0 || techniques.count( tech ) > 0;
+    return type->techniques.count( tech ) > 0 || cold().techniques.count( tech ) > 0;
 }
 
 void item::add_technique( const matec_id &tech )
 {
-    techniques.insert( tech );
+    edit_cold().techniques.insert( tech );
 }
 
 std::vector<item *> item::toolmods()
 {
     std::vector<item *> res;
     if( is_tool() ) {
-        for( item *e : contents.all_items_top( pocket_type::MOD ) ) {
+        for( item *e : contents.top_items( pocket_type::MOD ) ) {
             if( e->is_toolmod() ) {
                 res.push_back( e );
             }
@@ -7788,7 +7850,7 @@ std::vector<const item *> item::toolmods() const
 {
     std::vector<const item *> res;
     if( is_tool() ) {
-        for( const item *e : contents.all_items_top( pocket_type::MOD ) ) {
+        for( const item *e : contents.top_items( pocket_type::MOD ) ) {
             if( e->is_toolmod() ) {
                 res.push_back( e );
             }
@@ -7800,7 +7862,7 @@ std::vector<const item *> item::toolmods() const
 std::set<matec_id> item::get_techniques() const
 {
     std::set<matec_id> result = type->techniques;
-    result.insert( techniques.begin(), techniques.end() );
+    result.insert( cold().techniques.begin(), cold().techniques.end() );
     return result;
 }
 
@@ -7891,7 +7953,7 @@ void item::randomize_rot()
 
     for( item_pocket *pocket : contents.get_all_contained_pockets() ) {
         if( pocket->spoil_multiplier() > 0.0f ) {
-            for( item *subitem : pocket->all_items_top() ) {
+            for( item *subitem : pocket->top_items() ) {
                 subitem->randomize_rot();
             }
         }
@@ -7947,7 +8009,7 @@ int item::spoilage_sort_order() const
  * Rot maxes out at 105 F
  * Rot stops below 32 F (0C) and above 145 F (63 C)
  */
-float item::calc_hourly_rotpoints_at_temp( const units::temperature &temp ) const
+float item::calc_hourly_rotpoints_at_temp( const units::temperature &temp )
 {
     const units::temperature dropoff = units::from_fahrenheit( 38 ); // F, ~3 C
     const float max_rot_temp = 105; // F, ~41 C, Maximum rotting rate is at this temperature
@@ -7968,22 +8030,20 @@ float item::calc_hourly_rotpoints_at_temp( const units::temperature &temp ) cons
     }
 }
 
-void item::calc_rot( units::temperature temp, const float spoil_modifier,
-                     const time_duration &time_delta )
+float item::rot_factor( const float spoil_modifier ) const
 {
     // Avoid needlessly calculating already rotten things.  Corpses should
     // always rot away and food rots away at twice the shelf life.  If the food
     // is in a sealed container they won't rot away, this avoids needlessly
     // calculating their rot in that case.
     if( !is_corpse() && get_relative_rot() > 2.0 ) {
-        return;
+        return 0.0f;
     }
 
     if( has_own_flag( flag_FROZEN ) ) {
-        return;
+        return 0.0f;
     }
 
-    // rot modifier
     float factor = spoil_modifier;
     if( is_corpse() && has_flag( flag_FIELD_DRESS ) ) {
         factor *= 0.75;
@@ -8000,6 +8060,16 @@ void item::calc_rot( units::temperature temp, const float spoil_modifier,
     if( has_own_flag( flag_IRRADIATED ) ) {
         factor *= 0.25;
     }
+    return factor;
+}
+
+void item::calc_rot( units::temperature temp, const float spoil_modifier,
+                     const time_duration &time_delta )
+{
+    const float factor = rot_factor( spoil_modifier );
+    if( factor == 0.0f ) {
+        return;
+    }
 
     if( has_own_flag( flag_COLD ) ) {
         temp = std::min( temperatures::fridge, temp );
@@ -10186,7 +10256,7 @@ ret_val<void> item::can_contain( const item &it, int &copies_remaining, const bo
             const bool ignore_nested_rigidity =
                 !pkt->settings.accepts_item( it ) ||
                 !pkt->get_pocket_data()->get_flag_restrictions().empty() || pkt->is_holster();
-            for( const item *internal_it : pkt->all_items_top() ) {
+            for( const item *internal_it : pkt->top_items() ) {
                 if( parent_it.where() != item_location::type::invalid && internal_it == parent_it.get_item() ) {
                     continue;
                 }
@@ -10759,7 +10829,7 @@ int item::ammo_remaining( const std::set<ammotype> &ammo, const Character *carri
 
     // Magazines and integral magazines on their own
     if( is_magazine() ) {
-        for( const item *e : contents.all_items_top( pocket_type::MAGAZINE ) ) {
+        for( const item *e : contents.top_items( pocket_type::MAGAZINE ) ) {
             if( e->is_ammo() ) {
                 ret += e->charges;
             }
@@ -10768,7 +10838,7 @@ int item::ammo_remaining( const std::set<ammotype> &ammo, const Character *carri
 
     // Handle non-magazines with ammo_restriction in a CONTAINER type pocket (like quivers)
     if( !( mag || is_magazine() || ammo.empty() ) ) {
-        for( const item *e : contents.all_items_top( pocket_type::CONTAINER ) ) {
+        for( const item *e : contents.top_items( pocket_type::CONTAINER ) ) {
             if( e->is_ammo() && ammo.find( e->ammo_type() ) != ammo.end() ) {
                 ret += e->charges;
             }
@@ -10826,7 +10896,7 @@ units::energy item::energy_remaining( const Character *carrier ) const
 
     // Battery(ammo) contained within
     if( is_magazine() ) {
-        for( const item *e : contents.all_items_top( pocket_type::MAGAZINE ) ) {
+        for( const item *e : contents.top_items( pocket_type::MAGAZINE ) ) {
             if( e->typeId() == itype_battery ) {
                 ret += units::from_kilojoule( static_cast<std::int64_t>( e->charges ) );
             }
@@ -12616,18 +12686,19 @@ bool item::already_used_by_player( const Character &p ) const
     // ';<id>;' matches at most one part of USED_BY_IDS, and only when exactly that
     // id has been added.
     const std::string needle = string_format( ";%d;", p.getID().get_value() );
-    return it->second.find( needle ) != std::string::npos;
+    return it->second.str().find( needle ) != std::string::npos;
 }
 
 void item::mark_as_used_by_player( const Character &p )
 {
-    std::string &used_by_ids = item_vars[ USED_BY_IDS ];
+    std::string used_by_ids = get_var( USED_BY_IDS );
     if( used_by_ids.empty() ) {
         // *always* start with a ';'
         used_by_ids = ";";
     }
     // and always end with a ';'
     used_by_ids += string_format( "%d;", p.getID().get_value() );
+    set_var( USED_BY_IDS, used_by_ids );
 }
 
 bool item::can_holster( const item &obj, bool ) const
@@ -12714,7 +12785,8 @@ void item::apply_freezerburn()
 }
 
 bool item::process_temperature_rot( float insulation, const tripoint &pos, map &here,
-                                    Character *carrier, const temperature_flag flag, float spoil_modifier, bool watertight_container )
+                                    Character *carrier, const temperature_flag flag, float spoil_modifier, bool watertight_container,
+                                    pocket_thermal_state *thermal )
 {
     const time_point now = calendar::turn;
 
@@ -12732,33 +12804,17 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos, map &
         return false;
     }
 
-    units::temperature temp = get_weather().get_temperature( pos );
-
-    switch( flag ) {
-        case temperature_flag::NORMAL:
-            // Just use the temperature normally
-            break;
-        case temperature_flag::FRIDGE:
-            temp = std::min( temp, temperatures::fridge );
-            break;
-        case temperature_flag::FREEZER:
-            temp = std::min( temp, temperatures::freezer );
-            break;
-        case temperature_flag::HEATER:
-            temp = std::max( temp, temperatures::normal );
-            break;
-        case temperature_flag::ROOT_CELLAR:
-            temp = AVERAGE_ANNUAL_TEMPERATURE;
-            break;
-        default:
-            debugmsg( "Temperature flag enum not valid.  Using current temperature." );
+    // Items that are not in a pocket look at their surroundings on their own
+    std::optional<pocket_thermal_state> own_thermal;
+    if( thermal == nullptr ) {
+        thermal = &own_thermal.emplace( here, pos, flag, carrier != nullptr );
     }
+    const units::temperature temp = thermal->current_temperature();
 
     bool carried = carrier != nullptr;
-    // body heat increases inventory temperature by 5 F (2.77 K) and insulation by 50%
+    // body heat increases insulation by 50%
     if( carried ) {
         insulation *= 1.5;
-        temp += units::from_fahrenheit_delta( 5 );
     }
 
     time_point time = last_temp_check;
@@ -12772,58 +12828,32 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos, map &
     if( now - time > 1_hours ) {
         // This code is for items that were left out of reality bubble for long time
 
-        const weather_generator &wgen = get_weather().get_cur_weather_gen();
-        const unsigned int seed = g->get_seed();
+        // Process the past of this item in 1h chunks until there is less than 1h left.
+        time_duration time_delta = 1_hours;
 
-        units::temperature_delta temp_mod;
-        // Toilets and vending machines will try to get the heat radiation and convection during mapgen and segfault.
-        if( !g->new_game ) {
-            temp_mod = get_heat_radiation( pos );
-            temp_mod += get_convection_temperature( pos );
-            temp_mod += here.get_temperature_mod( pos );
-        } else {
-            temp_mod = units::from_kelvin_delta( 0 );
-        }
+        // The temperature of the item does not matter for the hours more than 2 d ago, only
+        // the rot does.  That rot is shared with the other items of the pocket and applied at once.
+        if( now - time > 2_days + time_delta && !decays_in_air &&
+            ( !process_rot || ( carrier == nullptr && !has_own_flag( flag_COLD ) ) ) ) {
+            const int old_hours = to_hours<int>( now - time - 2_days );
+            if( process_rot ) {
+                rot += rot_factor( spoil_modifier ) * time_delta / 1_hours *
+                       thermal->past_rotpoints( time, old_hours ) * 1_turns;
+            }
+            time += old_hours * time_delta;
+            last_temp_check = time;
 
-        if( carried ) {
-            temp_mod += units::from_fahrenheit_delta( 5 ); // body heat increases inventory temperature
+            if( process_rot && has_rotten_away() ) {
+                // No need to track item that will be gone
+                return true;
+            }
         }
 
-        // Process the past of this item in 1h chunks until there is less than 1h left.
-        time_duration time_delta = 1_hours;
-
         while( now - time > 1_hours ) {
             time += time_delta;
 
             // Get the environment temperature
-            // Use weather if above ground, use map temp if below
-            units::temperature env_temperature;
-            if( pos.z >= 0 && flag != temperature_flag::ROOT_CELLAR ) {
-                env_temperature = wgen.get_weather_temperature( pos, time, seed );
-            } else {
-                env_temperature = AVERAGE_ANNUAL_TEMPERATURE;
-            }
-            env_temperature += temp_mod;
-
-            switch( flag ) {
-                case temperature_flag::NORMAL:
-                    // Just use the temperature normally
-                    break;
-                case temperature_flag::FRIDGE:
-                    env_temperature = std::min( env_temperature, temperatures::fridge );
-                    break;
-                case temperature_flag::FREEZER:
-                    env_temperature = std::min( env_temperature, temperatures::freezer );
-                    break;
-                case temperature_flag::HEATER:
-                    env_temperature = std::max( env_temperature, temperatures::normal );
-                    break;
-                case temperature_flag::ROOT_CELLAR:
-                    env_temperature = AVERAGE_ANNUAL_TEMPERATURE;
-                    break;
-                default:
-                    debugmsg( "Temperature flag enum not valid.  Using normal temperature." );
-            }
+            const units::temperature env_temperature = thermal->past_temperature( time );
 
             // Calculate item temperature from environment temperature
             // If the time was more than 2 d ago we do not care about item temperature.
@@ -14115,14 +14145,16 @@ bool item::process_gun_cooling( Character *carrier )
 }
 
 bool item::process( map &here, Character *carrier, const tripoint &pos, float insulation,
-                    temperature_flag flag, float spoil_multiplier_parent, bool watertight_container, bool recursive )
+                    temperature_flag flag, float spoil_multiplier_parent, bool watertight_container, bool recursive,
+                    pocket_thermal_state *thermal )
 {
     return item::process( here, carrier, tripoint_bub_ms( pos ), insulation, flag,
-                          spoil_multiplier_parent, watertight_container, recursive );
+                          spoil_multiplier_parent, watertight_container, recursive, thermal );
 }
 
 bool item::process( map &here, Character *carrier, const tripoint_bub_ms &pos, float insulation,
-                    temperature_flag flag, float spoil_multiplier_parent, bool watertight_container, bool recursive )
+                    temperature_flag flag, float spoil_multiplier_parent, bool watertight_container, bool recursive,
+                    pocket_thermal_state *thermal )
 {
     process_relic( carrier, pos.raw() );
     if( recursive ) {
@@ -14130,7 +14162,7 @@ bool item::process( map &here, Character *carrier, const tripoint_bub_ms &pos, f
                           spoil_multiplier_parent, watertight_container );
     }
     return process_internal( here, carrier, pos.raw(), insulation, flag, spoil_multiplier_parent,
-                             watertight_container );
+                             watertight_container, thermal );
 }
 
 bool item::leak( map &here, Character *carrier, const tripoint &pos, item_pocket *pocke )
@@ -14157,7 +14189,8 @@ void item::set_last_temp_check( const time_point &pt )
 }
 
 bool item::process_internal( map &here, Character *carrier, const tripoint &pos,
-                             float insulation, const temperature_flag flag, float spoil_modifier, bool watertight_container )
+                             float insulation, const temperature_flag flag, float spoil_modifier, bool watertight_container,
+                             pocket_thermal_state *thermal )
 {
     if( ethereal ) {
         if( !has_var( "ethereal" ) ) {
@@ -14277,7 +14310,7 @@ bool item::process_internal( map &here, Character *carrier, const tripoint &pos,
         // All foods that go bad have temperature
         if( has_temperature() &&
             process_temperature_rot( insulation, pos, here, carrier, flag, spoil_modifier,
-                                     watertight_container ) ) {
+                                     watertight_container, thermal ) ) {
             if( is_comestible() ) {
                 here.rotten_item_spawn( *this, pos );
             }
@@ -14352,7 +14385,7 @@ bool item::is_dangerous() const
 
     // Note: Item should be dangerous regardless of what type of a container is it
     // Visitable interface would skip some options
-    for( const item *it : contents.all_items_top() ) {
+    for( const item *it : contents.top_items() ) {
         if( it->is_dangerous() ) {
             return true;
         }
@@ -14581,7 +14614,7 @@ std::string item::type_name( unsigned int quantity, bool use_variant, bool use_c
                                   corpse->nname() );
         }
     } else if( iter != item_vars.end() ) {
-        return iter->second;
+        return iter->second.str();
     } else if( use_variant && has_itype_variant() ) {
         ret_name = itype_variant().alt_name.translated( quantity );
     } else {
@@ -14656,14 +14689,14 @@ std::string item::type_name( unsigned int quantity, bool use_variant, bool use_c
 
     // Identify who this corpse belonged to, if applicable.
     if( corpse != nullptr && use_corpse && has_flag( flag_CORPSE ) ) {
-        if( corpse_name.empty() ) {
+        if( cold().corpse_name.empty() ) {
             //~ %1$s: name of corpse with modifiers;  %2$s: species name
             ret_name = string_format( pgettext( "corpse ownership qualifier", "%1$s of a %2$s" ),
                                       ret_name, corpse->nname() );
         } else {
             //~ %1$s: name of corpse with modifiers;  %2$s: proper name;  %3$s: species name
             ret_name = string_format( pgettext( "corpse ownership qualifier", "%1$s of %2$s, %3$s" ),
-                                      ret_name, corpse_name, corpse->nname() );
+                                      ret_name, cold().corpse_name, corpse->nname() );
         }
     }
 
@@ -14677,7 +14710,7 @@ const mtype *item::get_corpse_mon() const
 
 std::string item::get_corpse_name() const
 {
-    return corpse_name;
+    return cold().corpse_name;
 }
 
 std::string item::nname( const itype_id &id, unsigned int quantity )
@@ -14987,7 +15020,7 @@ units::volume item::check_for_free_space() const
 {
     units::volume volume;
 
-    for( const item *container : contents.all_items_top( pocket_type::CONTAINER ) ) {
+    for( const item *container : contents.top_items( pocket_type::CONTAINER ) ) {
         std::vector<const item_pocket *> containedPockets =
             container->contents.get_all_contained_pockets();
         if( !containedPockets.empty() ) {
@@ -15099,6 +15132,26 @@ std::list<item *> item::all_items_top( pocket_type pk_type, bool unloading )
     return contents.all_items_top( pk_type, unloading );
 }
 
+contents_item_range<const item> item::top_items() const
+{
+    return contents.top_items();
+}
+
+contents_item_range<item> item::top_items()
+{
+    return contents.top_items();
+}
+
+contents_item_range<const item> item::top_items( pocket_type pk_type ) const
+{
+    return contents.top_items( pk_type );
+}
+
+contents_item_range<item> item::top_items( pocket_type pk_type )
+{
+    return contents.top_items( pk_type );
+}
+
 item const *item::this_or_single_content() const
 {
     return type->category_force == item_category_container && contents_only_one_type()
@@ -15160,7 +15213,7 @@ item::aggregate_t item::aggregated_contents( int depth, int maxdepth ) const
     };
 
     for( item_pocket const *pk : contents.get_pockets( cont_and_soft ) ) {
-        for( item const *pkit : pk->all_items_top() ) {
+        for( item const *pkit : pk->top_items() ) {
             total++;
             item_category_id const cat = pkit->get_category_of_contents( depth, maxdepth ).get_id();
             bool const type_ok = pkit->type->category_force != item_category_container ||
@@ -15195,8 +15248,8 @@ std::list<const item *> item::all_items_ptr() const
     std::list<const item *> all_items_internal;
     for( int i = static_cast<int>( pocket_type::CONTAINER );
          i < static_cast<int>( pocket_type::LAST ); i++ ) {
-        std::list<const item *> inserted{ all_items_top_recursive( static_cast<pocket_type>( i ) ) };
-        all_items_internal.insert( all_items_internal.end(), inserted.begin(), inserted.end() );
+        all_items_internal.splice( all_items_internal.end(),
+                                   all_items_top_recursive( static_cast<pocket_type>( i ) ) );
     }
     return all_items_internal;
 }
@@ -15214,12 +15267,9 @@ std::list<item *> item::all_items_ptr( pocket_type pk_type )
 std::list<const item *> item::all_items_top_recursive( pocket_type pk_type )
 const
 {
-    std::list<const item *> contained = contents.all_items_top( pk_type );
-    std::list<const item *> all_items_internal{ contained };
-    for( const item *it : contained ) {
-        std::list<const item *> recursion_items = it->all_items_top_recursive( pk_type );
-        all_items_internal.insert( all_items_internal.end(), recursion_items.begin(),
-                                   recursion_items.end() );
+    std::list<const item *> all_items_internal = contents.all_items_top( pk_type );
+    for( const item *it : contents.top_items( pk_type ) ) {
+        all_items_internal.splice( all_items_internal.end(), it->all_items_top_recursive( pk_type ) );
     }
 
     return all_items_internal;
@@ -15227,12 +15277,9 @@ const
 
 std::list<item *> item::all_items_top_recursive( pocket_type pk_type )
 {
-    std::list<item *> contained = contents.all_items_top( pk_type );
-    std::list<item *> all_items_internal{ contained };
-    for( item *it : contained ) {
-        std::list<item *> recursion_items = it->all_items_top_recursive( pk_type );
-        all_items_internal.insert( all_items_internal.end(), recursion_items.begin(),
-                                   recursion_items.end() );
+    std::list<item *> all_items_internal = contents.all_items_top( pk_type );
+    for( item *it : contents.top_items( pk_type ) ) {
+        all_items_internal.splice( all_items_internal.end(), it->all_items_top_recursive( pk_type ) );
     }
 
     return all_items_internal;
@@ -27,6 +27,7 @@
 #include "item_contents.h"
 #include "item_location.h"
 #include "item_tname.h"
+#include "item_vars.h"
 #include "material.h"
 #include "requirements.h"
 #include "safe_reference.h"
@@ -658,6 +659,12 @@ class item : public visitable
         */
         units::mass weight( bool include_contents = true, bool integral = false ) const;
 
+        /**
+         * Estimated bytes of memory used by this item, its heap allocations and everything
+         * it contains. Counts container nodes, not allocator overhead.
+         */
+        size_t memory_usage() const;
+
         /**
          * Total volume of an item accounting for all contained/integrated items
          * NOTE: Result is rounded up to next nearest milliliter when working with stackable (@ref count_by_charges) items that have fractional volume per charge.
@@ -1024,7 +1031,7 @@ class item : public visitable
         /**
          * Returns rate of rot (rot/h) at the given temperature
          */
-        float calc_hourly_rotpoints_at_temp( const units::temperature &temp ) const;
+        static float calc_hourly_rotpoints_at_temp( const units::temperature &temp );
 
         /**
          * Accumulate rot of the item since last rot calculation.
@@ -1050,11 +1057,12 @@ class item : public visitable
          * @param pos The current position
          * @param carrier The current carrier
          * @param flag to specify special temperature situations
+         * @param thermal Surroundings shared with the other items in the same pocket, if any
          * @return true if the item is fully rotten and is ready to be removed
          */
         bool process_temperature_rot( float insulation, const tripoint &pos, map &here, Character *carrier,
                                       temperature_flag flag = temperature_flag::NORMAL, float spoil_modifier = 1.0f,
-                                      bool watertight_container = false );
+                                      bool watertight_container = false, pocket_thermal_state *thermal = nullptr );
 
         /** Set the item to HOT and resets last_temp_check */
         void heat_up();
@@ -1445,6 +1453,7 @@ class item : public visitable
          * @param activate Whether the item should be activated (true), or
          * processed as an active item.
          * @param spoil_multiplier_parent is the spoilage multiplier passed down from any parent item
+         * @param thermal Surroundings shared with the other items in the same pocket, if any
          * @return true if the item has been destroyed by the processing. The caller
          * should than delete the item wherever it was stored.
          * Returns false if the item is not destroyed.
@@ -1452,10 +1461,12 @@ class item : public visitable
         // TODO: Get rid of untyped overload.
         bool process( map &here, Character *carrier, const tripoint &pos, float insulation = 1,
                       temperature_flag flag = temperature_flag::NORMAL, float spoil_multiplier_parent = 1.0f,
-                      bool watertight_container = false, bool recursive = true );
+                      bool watertight_container = false, bool recursive = true,
+                      pocket_thermal_state *thermal = nullptr );
         bool process( map &here, Character *carrier, const tripoint_bub_ms &pos, float insulation = 1,
                       temperature_flag flag = temperature_flag::NORMAL, float spoil_multiplier_parent = 1.0f,
-                      bool watertight_container = false, bool recursive = true );
+                      bool watertight_container = false, bool recursive = true,
+                      pocket_thermal_state *thermal = nullptr );
 
         bool leak( map &here, Character *carrier, const tripoint &pos, item_pocket *pocke = nullptr );
 
@@ -1919,6 +1930,8 @@ class item : public visitable
         void set_var( const std::string &name, long value );
         void set_var( const std::string &name, double value );
         double get_var( const std::string &name, double default_value ) const;
+        /** Faster version for hot paths, keep the key in a static. */
+        double get_var( const item_var_key &name, double default_value ) const;
         void set_var( const std::string &name, const tripoint &value );
         tripoint get_var( const std::string &name, const tripoint &default_value ) const;
         void set_var( const std::string &name, const std::string &value );
@@ -1928,6 +1941,7 @@ class item : public visitable
         std::optional<std::string> maybe_get_var( const std::string &name ) const;
         /** Whether the variable is defined at all. */
         bool has_var( const std::string &name ) const;
+        bool has_var( const item_var_key &name ) const;
         /** Erase the value of the given variable. */
         void erase_var( const std::string &name );
         /** Removes all item variables. */
@@ -2942,6 +2956,12 @@ class item : public visitable
          *  if unloading is true it ignores items in pockets that are flagged to not unload
          */
         std::list<item *> all_items_top( pocket_type pk_type, bool unloading = false );
+        /** Same items as all_items_top(), without allocating a list for them */
+        contents_item_range<const item> top_items() const;
+        contents_item_range<item> top_items();
+        /** Same items as all_items_top( pk_type ), without allocating a list for them */
+        contents_item_range<const item> top_items( pocket_type pk_type ) const;
+        contents_item_range<item> top_items( pocket_type pk_type );
 
         item const *this_or_single_content() const;
         bool contents_only_one_type() const;
@@ -3023,7 +3043,10 @@ class item : public visitable
         template<typename Item>
         static Item *get_usable_item_helper( Item &self, const std::string &use_name );
         bool process_internal( map &here, Character *carrier, const tripoint &pos, float insulation,
-                               temperature_flag flag, float spoil_modifier, bool watertight_container );
+                               temperature_flag flag, float spoil_modifier, bool watertight_container,
+                               pocket_thermal_state *thermal );
+        /** Multiplier of the rot points this item accumulates, 0 if it does not rot any further. */
+        float rot_factor( float spoil_modifier ) const;
         void iterate_covered_body_parts_internal( side s,
                 const std::function<void( const bodypart_str_id & )> &cb ) const;
         void iterate_covered_sub_body_parts_internal( side s,
@@ -3110,14 +3133,26 @@ class item : public visitable
          */
         bool requires_tags_processing = true;
         cata::heap<FlagsSetType> item_tags; // generic item specific flags
-        cata::heap<FlagsSetType> inherited_tags_cache;
-        cata::heap<FlagsSetType> prefix_tags_cache; // flags that will add prefixes to this item
-        cata::heap<FlagsSetType> suffix_tags_cache; // flags that will add suffixes to this item
         lazy<safe_reference_anchor> anchor;
-        cata::heap<std::map<std::string, std::string>> item_vars;
+        item_var_map item_vars;
         const mtype *corpse = nullptr;
-        std::string corpse_name;       // Name of the late lamented
-        cata::heap<std::set<matec_id>> techniques; // item specific techniques
+
+        /**
+         * State that only few items have. It is allocated when an item first needs any of
+         * it, so the common item does not carry it around.
+         */
+        struct cold_data {
+            FlagsSetType inherited_tags_cache;
+            FlagsSetType prefix_tags_cache; // flags that will add prefixes to this item
+            FlagsSetType suffix_tags_cache; // flags that will add suffixes to this item
+            std::set<matec_id> techniques; // item specific techniques
+            std::string corpse_name;       // Name of the late lamented
+        };
+        cata::value_ptr<cold_data> cold_;
+        /** Cold data of this item, an empty one if it has none. */
+        const cold_data &cold() const;
+        /** Cold data of this item, allocated if needed. */
+        cold_data &edit_cold();
 
         // Select a random variant from the possibilities
         // Intended to be called when no explicit variant is set
@@ -3231,9 +3266,6 @@ class item : public visitable
         };
         mutable cat_cache cached_category;
 
-        // additional encumbrance this specific item has
-        units::volume additional_encumbrance = 0_ml;
-
     public:
         char invlet = 0;      // Inventory letter
         bool active = false; // If true, it has active effects to be processed
@@ -1,109 +1,143 @@
 #include "item_components.h"
 
+#include "cata_utility.h"
 #include "flag.h"
 #include "item.h"
 #include "itype.h"
 #include "type_id.h"
 
+item_components::comp_map &item_components::edit_comps()
+{
+    if( !comps ) {
+        comps = cata::make_value<comp_map>();
+    }
+    return *comps;
+}
+
+item_components::comp_map &item_components::no_comps()
+{
+    static comp_map empty_comps;
+    return empty_comps;
+}
+
 std::vector<item> item_components::operator[]( const itype_id it_id )
 {
-    return comps[it_id];
+    return edit_comps()[it_id];
 }
 
 item_components::comp_iterator item_components::begin()
 {
-    return comps.begin();
+    return comps ? comps->begin() : no_comps().begin();
 }
 item_components::comp_iterator item_components::end()
 {
-    return comps.end();
+    return comps ? comps->end() : no_comps().end();
 }
 item_components::const_comp_iterator item_components::begin() const
 {
-    return comps.begin();
+    return comps ? comps->cbegin() : no_comps().cbegin();
 }
 item_components::const_comp_iterator item_components::end() const
 {
-    return comps.end();
+    return comps ? comps->cend() : no_comps().cend();
 }
 
 bool item_components::empty()
 {
-    return comps.empty();
+    return !comps || comps->empty();
 }
 
 bool item_components::empty() const
 {
-    return comps.empty();
+    return !comps || comps->empty();
 }
 
 void item_components::clear()
 {
-    comps.clear();
+    comps.reset();
 }
 
 item item_components::only_item()
 {
-    if( comps.size() != 1 || comps.begin()->second.size() != 1 ) {
+    if( size() != 1 ) {
         debugmsg( "item_components::only_item called but components don't contain exactly one item" );
         return item();
     }
-    return *comps.begin()->second.begin();
+    return *comps->begin()->second.begin();
 }
 
 item item_components::only_item() const
 {
-    if( comps.size() != 1 || comps.begin()->second.size() != 1 ) {
+    if( size() != 1 ) {
         debugmsg( "item_components::only_item called but components don't contain exactly one item" );
         return item();
     }
-    return *comps.begin()->second.begin();
+    return *comps->begin()->second.begin();
 }
 
 size_t item_components::size() const
 {
     size_t ret = 0;
-    for( const type_vector_pair &tvp : comps ) {
+    for( const type_vector_pair &tvp : *this ) {
         ret += tvp.second.size();
     }
     return ret;
 }
 
+size_t item_components::memory_usage() const
+{
+    if( !comps ) {
+        return 0;
+    }
+    size_t bytes = sizeof( comp_map ) + tree_heap_bytes<type_vector_pair>( comps->size() );
+    for( const type_vector_pair &tvp : *comps ) {
+        bytes += ( tvp.second.capacity() - tvp.second.size() ) * sizeof( item );
+        for( const item &it : tvp.second ) {
+            bytes += it.memory_usage();
+        }
+    }
+    return bytes;
+}
+
 void item_components::add( item &new_it )
 {
-    comp_iterator it = comps.find( new_it.typeId() );
-    if( it != comps.end() ) {
+    comp_map &all_comps = edit_comps();
+    comp_iterator it = all_comps.find( new_it.typeId() );
+    if( it != all_comps.end() ) {
         if( it->first->count_by_charges() ) {
             it->second.front().charges += new_it.charges;
         } else {
             it->second.push_back( new_it );
         }
     } else {
-        comps[new_it.typeId()] = { new_it };
+        all_comps[new_it.typeId()] = { new_it };
     }
 }
 
 ret_val<item> item_components::remove( itype_id it_id )
 {
-    comp_iterator it = comps.find( it_id );
-    if( it == comps.end() ) {
+    if( !comps ) {
+        return ret_val<item>::make_failure( item() );
+    }
+    comp_iterator it = comps->find( it_id );
+    if( it == comps->end() ) {
         return ret_val<item>::make_failure( item() );
     }
     item itm = *it->second.begin();
     it->second.erase( it->second.begin() );
     if( it->second.empty() ) {
-        comps.erase( it );
+        comps->erase( it );
     }
     return ret_val<item>::make_success( itm );
 }
 
 item item_components::get_and_remove_random_entry()
 {
-    comp_iterator iter = comps.begin();
-    std::advance( iter, rng( 0, comps.size() - 1 ) );
+    comp_iterator iter = comps->begin();
+    std::advance( iter, rng( 0, comps->size() - 1 ) );
     item ret = random_entry_removed( iter->second );
     if( iter->second.empty() ) {
-        comps.erase( iter );
+        comps->erase( iter );
     }
     return ret;
 }
@@ -126,7 +160,7 @@ item_components item_components::split( const int batch_size, const size_t offse
 {
     item_components ret;
 
-    for( item_components::type_vector_pair &tvp : comps ) {
+    for( item_components::type_vector_pair &tvp : *this ) {
         if( tvp.first->count_by_charges() ) {
             if( tvp.second.size() != 1 ) {
                 debugmsg( "count by charges component %s wasn't merged properly, can't distribute components to resulting items",
@@ -164,12 +198,12 @@ item_components item_components::split( const int batch_size, const size_t offse
 
 void item_components::serialize( JsonOut &jsout ) const
 {
-    jsout.write( comps );
+    jsout.write( comps ? *comps : no_comps() );
 }
 
 void item_components::deserialize( const JsonValue &jv )
 {
-    comps.clear();
+    comps.reset();
     // read legacy arrays
     if( jv.test_array() ) {
         std::list<item> temp;
@@ -178,6 +212,6 @@ void item_components::deserialize( const JsonValue &jv )
             add( it );
         }
     } else {
-        jv.read( comps );
+        jv.read( edit_comps() );
     }
 }
@@ -19,9 +19,15 @@ class ret_val;
 class item_components
 {
     private:
-        cata::heap<std::map<itype_id, std::vector<item>>> comps;
-        using comp_iterator = std::map<itype_id, std::vector<item>>::iterator;
-        using const_comp_iterator = std::map<itype_id, std::vector<item>>::const_iterator;
+        using comp_map = std::map<itype_id, std::vector<item>>;
+        // Most items have no components, the map is only allocated once one is added.
+        cata::value_ptr<comp_map> comps;
+        using comp_iterator = comp_map::iterator;
+        using const_comp_iterator = comp_map::const_iterator;
+
+        comp_map &edit_comps();
+        // Shared empty map to iterate while there are no components, never modified.
+        static comp_map &no_comps();
 
     public:
         using type_vector_pair = std::pair<const itype_id, std::vector<item>>;
@@ -43,6 +49,8 @@ class item_components
 
         // total number of items in components
         size_t size() const;
+        // estimated heap bytes, including the component items, see item::memory_usage
+        size_t memory_usage() const;
         void add( item &new_it );
         ret_val<item> remove( itype_id it_id );
         // components must not be empty!
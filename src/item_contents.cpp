@@ -160,7 +160,7 @@ void pocket_favorite_callback::add_pockets( item &i, uilist &pocket_selector,
         pocket_num++;
 
         // display the items
-        for( item *it : it_pocket->all_items_top() ) {
+        for( item *it : it_pocket->top_items() ) {
             // check for pockets in that pocket
             add_pockets( *it, pocket_selector, depth + "  " );
         }
@@ -187,7 +187,7 @@ void pocket_favorite_callback::move_item( uilist *menu, item_pocket *selected_po
     if( item_to_move.second == nullptr ) {
         selector_menu.title = _( "Select an item from the pocket" );
         std::vector<item *> item_list;
-        for( item *it_in : selected_pocket->all_items_top() ) {
+        for( item *it_in : selected_pocket->top_items() ) {
             item_list.emplace_back( it_in );
         }
 
@@ -658,11 +658,23 @@ size_t item_contents::size() const
     return contents.size();
 }
 
+size_t item_contents::memory_usage() const
+{
+    size_t bytes = 0;
+    for( const item_pocket &pocket : contents ) {
+        bytes += 2 * sizeof( void * ) + sizeof( item_pocket ) + pocket.memory_usage();
+    }
+    for( const item &it : additional_pockets ) {
+        bytes += it.memory_usage();
+    }
+    return bytes;
+}
+
 void item_contents::read_mods( const item_contents &read_input )
 {
     for( const item_pocket &pocket : read_input.contents ) {
         if( pocket.saved_type() == pocket_type::MOD ) {
-            for( const item *it : pocket.all_items_top() ) {
+            for( const item *it : pocket.top_items() ) {
                 if( it->is_gunmod() || it->is_toolmod() ) {
                     insert_item( *it, pocket_type::MOD );
                 } else {
@@ -695,7 +707,7 @@ void item_contents::combine( const item_contents &read_input, const bool convert
                     pocket.is_type( pocket_type::SOFTWARE ) ||
                     pocket.is_type( pocket_type::EBOOK ) ) {
                     ++pocket_index;
-                    for( const item *it : pocket.all_items_top() ) {
+                    for( const item *it : pocket.top_items() ) {
                         insert_item( *it, pocket.get_pocket_data()->type, ignore_contents );
                     }
                     continue;
@@ -712,7 +724,7 @@ void item_contents::combine( const item_contents &read_input, const bool convert
                     continue;
                 } else if( pocket.saved_type() == pocket_type::MIGRATION ||
                            pocket.saved_type() == pocket_type::CORPSE ) {
-                    for( const item *it : pocket.all_items_top() ) {
+                    for( const item *it : pocket.top_items() ) {
                         insert_item( *it, pocket.saved_type(), ignore_contents );
                     }
                     ++pocket_index;
@@ -728,7 +740,7 @@ void item_contents::combine( const item_contents &read_input, const bool convert
                 continue;
             }
 
-            for( const item *it : pocket.all_items_top() ) {
+            for( const item *it : pocket.top_items() ) {
                 const ret_val<item *> inserted = current_pocket_iter->insert_item( *it,
                                                  into_bottom, restack_charges, ignore_contents );
                 if( !inserted.success() ) {
@@ -743,7 +755,7 @@ void item_contents::combine( const item_contents &read_input, const bool convert
             }
             current_pocket_iter->settings = pocket.settings;
         } else {
-            for( const item *it : pocket.all_items_top() ) {
+            for( const item *it : pocket.top_items() ) {
                 uninserted_items.push_back( *it );
             }
         }
@@ -752,7 +764,7 @@ void item_contents::combine( const item_contents &read_input, const bool convert
 
     for( const item_pocket &pocket : mismatched_pockets ) {
         const pocket_type mismatched_type = convert ? pocket.get_pocket_data()->type : pocket.saved_type();
-        for( const item *it : pocket.all_items_top() ) {
+        for( const item *it : pocket.top_items() ) {
             const ret_val<item *> inserted = insert_item( *it, mismatched_type, ignore_contents );
             if( !inserted.success() ) {
                 uninserted_items.push_back( *it );
@@ -1335,7 +1347,7 @@ item &item_contents::first_ammo()
             continue;
         }
         if( pocket.front().has_flag( json_flag_CASING ) ) {
-            for( item *i : pocket.all_items_top() ) {
+            for( item *i : pocket.top_items() ) {
                 if( !i->has_flag( json_flag_CASING ) ) {
                     return *i;
                 }
@@ -1361,7 +1373,7 @@ const item &item_contents::first_ammo() const
             continue;
         }
         if( pocket.front().has_flag( json_flag_CASING ) ) {
-            for( const item *i : pocket.all_items_top() ) {
+            for( const item *i : pocket.top_items() ) {
                 if( !i->has_flag( json_flag_CASING ) ) {
                     return *i;
                 }
@@ -1680,8 +1692,9 @@ std::list<item *> item_contents::all_items_top( const std::function<bool( item_p
     std::list<item *> all_items_internal;
     for( item_pocket &pocket : contents ) {
         if( filter( pocket ) ) {
-            std::list<item *> contained_items = pocket.all_items_top();
-            all_items_internal.splice( all_items_internal.end(), std::move( contained_items ) );
+            for( item *it : pocket.top_items() ) {
+                all_items_internal.push_back( it );
+            }
         }
     }
     return all_items_internal;
@@ -1707,8 +1720,9 @@ std::list<const item *> item_contents::all_items_top( const
     std::list<const item *> all_items_internal;
     for( const item_pocket &pocket : contents ) {
         if( filter( pocket ) ) {
-            std::list<const item *> contained_items = pocket.all_items_top();
-            all_items_internal.splice( all_items_internal.end(), std::move( contained_items ) );
+            for( const item *it : pocket.top_items() ) {
+                all_items_internal.push_back( it );
+            }
         }
     }
     return all_items_internal;
@@ -1723,7 +1737,7 @@ content_newness item_contents::get_content_newness( const std::set<itype_id> &re
             ret = content_newness::MIGHT_BE_HIDDEN;
             continue;
         }
-        for( const item *itm : pocket->all_items_top() ) {
+        for( const item *itm : pocket->top_items() ) {
             if( !read_items.count( itm->typeId() ) ) {
                 return content_newness::NEW;
             }
@@ -1761,6 +1775,36 @@ std::list<const item *> item_contents::all_items_top() const
     } );
 }
 
+static bool pocket_is_type( const item_pocket &pocket, pocket_type pk_type )
+{
+    return pocket.is_type( pk_type );
+}
+
+static bool pocket_is_standard_type( const item_pocket &pocket, pocket_type )
+{
+    return pocket.is_standard_type();
+}
+
+contents_item_range<item> item_contents::top_items( pocket_type pk_type )
+{
+    return contents_item_range<item>( contents, pocket_is_type, pk_type );
+}
+
+contents_item_range<const item> item_contents::top_items( pocket_type pk_type ) const
+{
+    return contents_item_range<const item>( contents, pocket_is_type, pk_type );
+}
+
+contents_item_range<item> item_contents::top_items()
+{
+    return contents_item_range<item>( contents, pocket_is_standard_type );
+}
+
+contents_item_range<const item> item_contents::top_items() const
+{
+    return contents_item_range<const item>( contents, pocket_is_standard_type );
+}
+
 std::list<item *> item_contents::all_known_contents()
 {
     return all_items_top( []( const item_pocket & pocket ) {
@@ -1795,7 +1839,7 @@ item &item_contents::legacy_front()
         debugmsg( "naively asked for first content item and will get a nullptr" );
         return null_item_reference();
     }
-    return *all_items_top().front();
+    return **top_items().begin();
 }
 
 const item &item_contents::legacy_front() const
@@ -1804,7 +1848,7 @@ const item &item_contents::legacy_front() const
         debugmsg( "naively asked for first content item and will get a nullptr" );
         return null_item_reference();
     }
-    return *all_items_top().front();
+    return **top_items().begin();
 }
 
 std::vector<item *> item_contents::gunmods()
@@ -1846,7 +1890,7 @@ std::vector<const item *> item_contents::mods() const
     std::vector<const item *> mods;
     for( const item_pocket &pocket : contents ) {
         if( pocket.is_type( pocket_type::MOD ) ) {
-            for( const item *it : pocket.all_items_top() ) {
+            for( const item *it : pocket.top_items() ) {
                 mods.insert( mods.end(), it );
             }
         }
@@ -1859,7 +1903,7 @@ std::vector<const item *> item_contents::softwares() const
     std::vector<const item *> softwares;
     for( const item_pocket &pocket : contents ) {
         if( pocket.is_type( pocket_type::SOFTWARE ) ) {
-            for( const item *it : pocket.all_items_top() ) {
+            for( const item *it : pocket.top_items() ) {
                 softwares.insert( softwares.end(), it );
             }
         }
@@ -1872,7 +1916,7 @@ std::vector<item *> item_contents::ebooks()
     std::vector<item *> ebooks;
     for( item_pocket &pocket : contents ) {
         if( pocket.is_type( pocket_type::EBOOK ) ) {
-            for( item *it : pocket.all_items_top() ) {
+            for( item *it : pocket.top_items() ) {
                 ebooks.emplace_back( it );
             }
         }
@@ -1885,7 +1929,7 @@ std::vector<const item *> item_contents::ebooks() const
     std::vector<const item *> ebooks;
     for( const item_pocket &pocket : contents ) {
         if( pocket.is_type( pocket_type::EBOOK ) ) {
-            for( const item *it : pocket.all_items_top() ) {
+            for( const item *it : pocket.top_items() ) {
                 ebooks.emplace_back( it );
             }
         }
@@ -1898,7 +1942,7 @@ std::vector<item *> item_contents::cables()
     std::vector<item *> cables;
     for( item_pocket &pocket : contents ) {
         if( pocket.is_type( pocket_type::CABLE ) ) {
-            for( item *it : pocket.all_items_top() ) {
+            for( item *it : pocket.top_items() ) {
                 cables.emplace_back( it );
             }
         }
@@ -1911,7 +1955,7 @@ std::vector<const item *> item_contents::cables() const
     std::vector<const item *> cables;
     for( const item_pocket &pocket : contents ) {
         if( pocket.is_type( pocket_type::CABLE ) ) {
-            for( const item *it : pocket.all_items_top() ) {
+            for( const item *it : pocket.top_items() ) {
                 // TODO: remove flag check after 0.H
                 if( it->has_flag( STATIC( flag_id( "CABLE_SPOOL" ) ) ) ) {
                     cables.emplace_back( it );
@@ -2439,7 +2483,7 @@ units::volume item_contents::get_contents_volume_with_tweaks( const std::map<con
                 ret += pocket->volume_capacity();
             }
         } else {
-            for( const item *i : pocket->all_items_top() ) {
+            for( const item *i : pocket->top_items() ) {
                 if( i->count_by_charges() ) {
                     ret += i->volume() - i->get_selected_stack_volume( without );
                 } else if( !without.count( i ) ) {
@@ -2466,7 +2510,7 @@ units::volume item_contents::get_nested_content_volume_recursive( const
                 ret += pocket->volume_capacity();
             }
         } else {
-            for( const item *i : pocket->all_items_top() ) {
+            for( const item *i : pocket->top_items() ) {
                 if( i->count_by_charges() ) {
                     ret += i->get_selected_stack_volume( without );
                 } else if( without.count( i ) ) {
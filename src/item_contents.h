@@ -5,10 +5,12 @@
 #include <cstddef>
 #include <functional>
 #include <iosfwd>
+#include <iterator>
 #include <list>
 #include <map>
 #include <optional>
 #include <set>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -34,6 +36,102 @@ enum class content_newness {
     SEEN
 };
 
+/**
+ * The items directly in those pockets of an item that pass a filter, as pointers like
+ * @ref item_contents::all_items_top returns them, but iterated in place instead of
+ * collected into a new list first.
+ * Adding or removing items or pockets while iterating is not supported.
+ */
+template<typename Item>
+class contents_item_range
+{
+    public:
+        using pocket_list = std::conditional_t<std::is_const_v<Item>, const std::list<item_pocket>,
+              std::list<item_pocket>>;
+        using pocket_iterator = decltype( std::declval<pocket_list &>().begin() );
+        using item_iterator = typename pocket_item_range<Item>::iterator;
+        using pocket_filter = bool ( * )( const item_pocket &, pocket_type );
+
+        class iterator
+        {
+            public:
+                using difference_type = std::ptrdiff_t;
+                using value_type = Item *;
+                using pointer = Item *const *;
+                using reference = Item *;
+                using iterator_category = std::forward_iterator_tag;
+
+                iterator() = default;
+                iterator( pocket_iterator pocket, pocket_iterator pocket_end, pocket_filter filter,
+                          pocket_type type ) : pocket( pocket ), pocket_end( pocket_end ), filter( filter ),
+                    type( type ) {
+                    enter_pocket();
+                }
+
+                Item *operator*() const {
+                    return *it;
+                }
+                iterator &operator++() {
+                    if( ++it == it_end ) {
+                        ++pocket;
+                        enter_pocket();
+                    }
+                    return *this;
+                }
+                iterator operator++( int ) {
+                    iterator ret = *this;
+                    ++*this;
+                    return ret;
+                }
+                bool operator==( const iterator &rhs ) const {
+                    return pocket == rhs.pocket && ( pocket == pocket_end || it == rhs.it );
+                }
+                bool operator!=( const iterator &rhs ) const {
+                    return !operator==( rhs );
+                }
+
+            private:
+                // moves on to the first item of the next matching pocket that is not empty
+                void enter_pocket() {
+                    for( ; pocket != pocket_end; ++pocket ) {
+                        if( filter( *pocket, type ) ) {
+                            const pocket_item_range<Item> items = pocket->top_items();
+                            if( !items.empty() ) {
+                                it = items.begin();
+                                it_end = items.end();
+                                return;
+                            }
+                        }
+                    }
+                }
+
+                pocket_iterator pocket;
+                pocket_iterator pocket_end;
+                item_iterator it;
+                item_iterator it_end;
+                pocket_filter filter = nullptr;
+                pocket_type type = pocket_type::LAST;
+        };
+
+        contents_item_range( pocket_list &pockets, pocket_filter filter,
+                             pocket_type type = pocket_type::LAST ) : pockets( pockets ), filter( filter ), type( type ) {}
+
+        iterator begin() const {
+            return iterator( pockets.begin(), pockets.end(), filter, type );
+        }
+        iterator end() const {
+            return iterator( pockets.end(), pockets.end(), filter, type );
+        }
+        bool empty() const {
+            return begin() == end();
+        }
+
+    private:
+        pocket_list &pockets;
+        pocket_filter filter;
+        pocket_type type;
+};
+
 class item_contents
 {
     public:
@@ -108,6 +206,8 @@ class item_contents
         bool bigger_on_the_inside( const units::volume &container_volume ) const;
         // number of pockets
         size_t size() const;
+        /** Estimated heap bytes of the pockets and their contents, see @ref item::memory_usage. */
+        size_t memory_usage() const;
 
         /** returns a list of pointers to all top-level items from pockets that match the predicate */
         std::list<item *> all_items_top( const std::function<bool( item_pocket & )> &filter );
@@ -125,6 +225,13 @@ class item_contents
         /** returns a list of pointers to all top-level items that are not mods */
         std::list<const item *> all_items_top() const;
 
+        /** Same items as all_items_top( pk_type ), without allocating a list for them */
+        contents_item_range<item> top_items( pocket_type pk_type );
+        contents_item_range<const item> top_items( pocket_type pk_type ) const;
+        /** Same items as all_items_top(), without allocating a list for them */
+        contents_item_range<item> top_items();
+        contents_item_range<const item> top_items() const;
+
         /** returns a list of pointers to all visible or remembered content items that are not mods */
         std::list<item *> all_known_contents();
         std::list<const item *> all_known_contents() const;
@@ -4606,7 +4606,7 @@ static void apply_migration( const migration *migrant, item &obj )
     if( migrant->reset_item_vars ) {
         obj.clear_vars();
         for( const auto &pair : migrant->replace.obj().item_variables ) {
-            obj.set_var( pair.first, pair.second ) ;
+            obj.set_var( pair.first.str(), pair.second.str() ) ;
         }
     }
     for( const std::string &f : migrant->flags ) {
@@ -49,7 +49,7 @@ class migration
         std::set<std::string> flags;
         int charges = 0;
 
-        // if set to true then reset item_vars std::map to the value of itype's item_variables
+        // if set to true then reset item_vars to the value of itype's item_variables
         bool reset_item_vars = false;
 
         class content
@@ -16,6 +16,8 @@
 #include "debug.h"
 #include "enums.h"
 #include "flag.h"
+#include "game.h"
+#include "game_constants.h"
 #include "generic_factory.h"
 #include "handle_liquid.h"
 #include "item.h"
@@ -34,6 +36,7 @@
 #include "translations.h"
 #include "units.h"
 #include "units_utility.h"
+#include "weather.h"
 
 namespace io
 {
@@ -492,16 +495,24 @@ std::list<const item *> item_pocket::all_items_top() const
     return items;
 }
 
+pocket_item_range<item> item_pocket::top_items()
+{
+    return pocket_item_range<item>( contents.begin(), contents.end() );
+}
+
+pocket_item_range<const item> item_pocket::top_items() const
+{
+    return pocket_item_range<const item>( contents.begin(), contents.end() );
+}
+
 std::list<item *> item_pocket::all_items_ptr( pocket_type pk_type )
 {
     if( !is_type( pk_type ) ) {
         return std::list<item *>();
     }
     std::list<item *> all_items_top_level{ all_items_top() };
-    for( item *it : all_items_top_level ) {
-        std::list<item *> all_items_internal{ it->all_items_ptr( pk_type ) };
-        all_items_top_level.insert( all_items_top_level.end(), all_items_internal.begin(),
-                                    all_items_internal.end() );
+    for( item &it : contents ) {
+        all_items_top_level.splice( all_items_top_level.end(), it.all_items_ptr( pk_type ) );
     }
     return all_items_top_level;
 }
@@ -512,10 +523,8 @@ std::list<const item *> item_pocket::all_items_ptr( pocket_type pk_type ) const
         return std::list<const item *>();
     }
     std::list<const item *> all_items_top_level{ all_items_top() };
-    for( const item *it : all_items_top_level ) {
-        std::list<const item *> all_items_internal{ it->all_items_ptr( pk_type ) };
-        all_items_top_level.insert( all_items_top_level.end(), all_items_internal.begin(),
-                                    all_items_internal.end() );
+    for( const item &it : contents ) {
+        all_items_top_level.splice( all_items_top_level.end(), it.all_items_ptr( pk_type ) );
     }
     return all_items_top_level;
 }
@@ -555,6 +564,16 @@ size_t item_pocket::size() const
     return contents.size();
 }
 
+size_t item_pocket::memory_usage() const
+{
+    size_t bytes = 0;
+    for( const item &it : contents ) {
+        // list nodes hold two pointers next to the item
+        bytes += 2 * sizeof( void * ) + it.memory_usage();
+    }
+    return bytes;
+}
+
 units::volume item_pocket::volume_capacity() const
 {
     return data->volume_capacity;
@@ -1982,14 +2001,108 @@ void item_pocket::remove_items_if( const std::function<bool( item & )> &filter )
     on_contents_changed();
 }
 
+pocket_thermal_state::pocket_thermal_state( map &here, const tripoint &pos,
+        temperature_flag flag, bool carried )
+    : here( here ), pos( pos ), flag( flag ), carried( carried )
+{
+}
+
+units::temperature pocket_thermal_state::current_temperature()
+{
+    if( !current ) {
+        current = apply_flag( get_weather().get_temperature( pos ) );
+        // body heat increases inventory temperature by 5 F (2.77 K)
+        if( carried ) {
+            *current += units::from_fahrenheit_delta( 5 );
+        }
+    }
+    return *current;
+}
+
+units::temperature pocket_thermal_state::apply_flag( units::temperature temp ) const
+{
+    switch( flag ) {
+        case temperature_flag::NORMAL:
+            // Just use the temperature normally
+            return temp;
+        case temperature_flag::FRIDGE:
+            return std::min( temp, temperatures::fridge );
+        case temperature_flag::FREEZER:
+            return std::min( temp, temperatures::freezer );
+        case temperature_flag::HEATER:
+            return std::max( temp, temperatures::normal );
+        case temperature_flag::ROOT_CELLAR:
+            return AVERAGE_ANNUAL_TEMPERATURE;
+        default:
+            debugmsg( "Temperature flag enum not valid.  Using current temperature." );
+    }
+    return temp;
+}
+
+units::temperature pocket_thermal_state::past_temperature( const time_point &t )
+{
+    const auto cached = past_temperatures.find( t );
+    if( cached != past_temperatures.end() ) {
+        return cached->second;
+    }
+
+    if( !past_temperature_mod ) {
+        // Toilets and vending machines will try to get the heat radiation and convection during mapgen and segfault.
+        if( !g->new_game ) {
+            past_temperature_mod = get_heat_radiation( pos ) + get_convection_temperature( pos ) +
+                                   here.get_temperature_mod( pos );
+        } else {
+            past_temperature_mod = units::from_kelvin_delta( 0 );
+        }
+        if( carried ) {
+            *past_temperature_mod += units::from_fahrenheit_delta( 5 );
+        }
+    }
+
+    // Use weather if above ground, use map temp if below
+    units::temperature temp;
+    if( pos.z >= 0 && flag != temperature_flag::ROOT_CELLAR ) {
+        weather_manager &weather = get_weather();
+        temp = weather.timeline.temperature( weather.get_cur_weather_gen(), g->get_seed(), pos, t );
+    } else {
+        temp = AVERAGE_ANNUAL_TEMPERATURE;
+    }
+    temp = apply_flag( temp + *past_temperature_mod );
+    past_temperatures.emplace( t, temp );
+    return temp;
+}
+
+float pocket_thermal_state::past_rotpoints( const time_point &start, int hours )
+{
+    const std::pair<time_point, int> key( start, hours );
+    const auto cached = past_rotpoints_cache.find( key );
+    if( cached != past_rotpoints_cache.end() ) {
+        return cached->second;
+    }
+
+    float rotpoints = 0.0f;
+    time_point t = start;
+    for( int i = 0; i < hours; ++i ) {
+        t += 1_hours;
+        rotpoints += item::calc_hourly_rotpoints_at_temp( past_temperature( t ) );
+    }
+    past_rotpoints_cache.emplace( key, rotpoints );
+    return rotpoints;
+}
+
 void item_pocket::process( map &here, Character *carrier, const tripoint &pos, float insulation,
                            temperature_flag flag, float spoil_multiplier_parent, bool watertight_container )
 {
+    if( contents.empty() ) {
+        return;
+    }
+    // everything in here shares its surroundings
+    pocket_thermal_state thermal( here, pos, flag, carrier != nullptr );
     for( auto iter = contents.begin(); iter != contents.end(); ) {
         if( iter->process( here, carrier, pos, insulation, flag,
                            // spoil multipliers on pockets are not additive or multiplicative, they choose the best
                            std::min( spoil_multiplier_parent, spoil_multiplier() ),
-                           watertight_container || can_contain_liquid( false ) ) ) {
+                           watertight_container || can_contain_liquid( false ), true, &thermal ) ) {
             iter->spill_contents( pos );
             iter = contents.erase( iter );
         } else {
@@ -5,17 +5,21 @@
 #include <cstddef>
 #include <functional>
 #include <iosfwd>
+#include <iterator>
 #include <list>
 #include <map>
 #include <new>
 #include <optional>
 #include <set>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "calendar.h"
 #include "enums.h"
 #include "flat_set.h"
 #include "pocket_type.h"
+#include "point.h"
 #include "ret_val.h"
 #include "type_id.h"
 #include "units.h"
@@ -30,9 +34,72 @@ class item_location;
 class pocket_data;
 struct iteminfo;
 struct itype;
-struct tripoint;
 class map;
 
+/**
+ * The items directly in a pocket as pointers, like @ref item_pocket::all_items_top returns
+ * them, but iterated in place instead of copied into a new list first.
+ * Adding or removing items from the pocket while iterating is not supported.
+ */
+template<typename Item>
+class pocket_item_range
+{
+    public:
+        using list_iterator = std::conditional_t<std::is_const_v<Item>, std::list<item>::const_iterator,
+              std::list<item>::iterator>;
+
+        class iterator
+        {
+            public:
+                using difference_type = std::ptrdiff_t;
+                using value_type = Item *;
+                using pointer = Item *const *;
+                using reference = Item *;
+                using iterator_category = std::forward_iterator_tag;
+
+                iterator() = default;
+                explicit iterator( list_iterator it ) : it( it ) {}
+
+                Item *operator*() const {
+                    return &*it;
+                }
+                iterator &operator++() {
+                    ++it;
+                    return *this;
+                }
+                iterator operator++( int ) {
+                    iterator ret = *this;
+                    ++it;
+                    return ret;
+                }
+                bool operator==( const iterator &rhs ) const {
+                    return it == rhs.it;
+                }
+                bool operator!=( const iterator &rhs ) const {
+                    return it != rhs.it;
+                }
+
+            private:
+                list_iterator it;
+        };
+
+        pocket_item_range( list_iterator first, list_iterator last ) : first( first ), last( last ) {}
+
+        iterator begin() const {
+            return iterator( first );
+        }
+        iterator end() const {
+            return iterator( last );
+        }
+        bool empty() const {
+            return first == last;
+        }
+
+    private:
+        list_iterator first;
+        list_iterator last;
+};
+
 class item_pocket
 {
     public:
@@ -165,6 +232,9 @@ class item_pocket
 
         std::list<item *> all_items_top();
         std::list<const item *> all_items_top() const;
+        /** Same items as all_items_top(), without allocating a list for them */
+        pocket_item_range<item> top_items();
+        pocket_item_range<const item> top_items() const;
         std::list<item *> all_items_ptr( pocket_type pk_type );
         std::list<const item *> all_items_ptr( pocket_type pk_type ) const;
 
@@ -173,6 +243,8 @@ class item_pocket
         item &front();
         const item &front() const;
         size_t size() const;
+        /** Estimated heap bytes of the contained items, see @ref item::memory_usage. */
+        size_t memory_usage() const;
         void pop_back();
 
         /**
@@ -418,6 +490,45 @@ class item_pocket
                                             bool ignore_contents ) const;
 };
 
+/**
+ * The surroundings of the contents of a pocket while they are processed.
+ *
+ * Everything in one pocket shares its position, carrier and temperature flag, so the
+ * temperature around it is worked out once per pocket instead of once for every item.
+ * For contents that spent a long time outside the reality bubble the temperature of each
+ * past hour is remembered as well, together with the rot those hours add up to, so a
+ * fridge full of food only walks through the hours it was away once.
+ */
+class pocket_thermal_state
+{
+    public:
+        pocket_thermal_state( map &here, const tripoint &pos, temperature_flag flag, bool carried );
+
+        /** Temperature around the contents right now. */
+        units::temperature current_temperature();
+        /** Temperature around the contents at @p t, used while catching up on past hours. */
+        units::temperature past_temperature( const time_point &t );
+        /**
+         * Sum of @ref item::calc_hourly_rotpoints_at_temp over @p hours whole hours,
+         * starting after @p start.
+         */
+        float past_rotpoints( const time_point &start, int hours );
+
+    private:
+        units::temperature apply_flag( units::temperature temp ) const;
+
+        map &here;
+        tripoint pos;
+        temperature_flag flag;
+        bool carried;
+        // everything is looked up on first use, lots of pockets hold nothing that has a temperature
+        std::optional<units::temperature> current;
+        // heat sources around the contents, only needed for past hours
+        std::optional<units::temperature_delta> past_temperature_mod;
+        std::map<time_point, units::temperature> past_temperatures;
+        std::map<std::pair<time_point, int>, float> past_rotpoints_cache;
+};
+
 /**
  *  There are a few implicit things about this struct when applied to pocket_data:
  *  - When a pocket_data::open_container == true, if it's sealed this is false.
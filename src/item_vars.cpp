@@ -0,0 +1,192 @@
+#include "item_vars.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <unordered_map>
+
+#include "cata_utility.h"
+#include "flexbuffer_json-inl.h"
+#include "flexbuffer_json.h"
+#include "json.h"
+#include "string_formatter.h"
+
+namespace
+{
+struct interned_var_names {
+    std::unordered_map<std::string, int> ids;
+    std::vector<const std::string *> names;
+
+    interned_var_names() {
+        // id 0 is the empty name of default constructed keys
+        intern( std::string() );
+    }
+
+    int intern( const std::string &name ) {
+        const auto inserted = ids.emplace( name, static_cast<int>( names.size() ) );
+        if( inserted.second ) {
+            names.push_back( &inserted.first->first );
+        }
+        return inserted.first->second;
+    }
+};
+} // namespace
+
+static interned_var_names &get_interned_var_names()
+{
+    static interned_var_names names;
+    return names;
+}
+
+item_var_key::item_var_key( const std::string &name ) :
+    id( get_interned_var_names().intern( name ) ) {}
+
+std::optional<item_var_key> item_var_key::lookup( const std::string &name )
+{
+    const interned_var_names &names = get_interned_var_names();
+    const auto it = names.ids.find( name );
+    if( it == names.ids.end() ) {
+        return std::nullopt;
+    }
+    return item_var_key( it->second );
+}
+
+const std::string &item_var_key::str() const
+{
+    return *get_interned_var_names().names[id];
+}
+
+item_var_value::item_var_value( std::string text ) : value( std::move( text ) )
+{
+    const std::string &s = std::get<std::string>( value );
+    if( s.empty() || !( ( s[0] >= '0' && s[0] <= '9' ) || s[0] == '-' ) ) {
+        return;
+    }
+    char *end;
+    errno = 0;
+    const long long integer = std::strtoll( s.c_str(), &end, 10 );
+    if( errno == 0 && *end == '\0' ) {
+        if( std::to_string( integer ) == s ) {
+            value = integer;
+        }
+        return;
+    }
+    errno = 0;
+    const double real = std::strtod( s.c_str(), &end );
+    if( errno == 0 && *end == '\0' && string_format( "%f", real ) == s ) {
+        value = real;
+    }
+}
+
+item_var_value::item_var_value( double number ) :
+    value( std::strtod( string_format( "%f", number ).c_str(), nullptr ) ) {}
+
+std::string item_var_value::str() const
+{
+    if( const long long *integer = std::get_if<long long>( &value ) ) {
+        return std::to_string( *integer );
+    }
+    if( const double *real = std::get_if<double>( &value ) ) {
+        return string_format( "%f", *real );
+    }
+    return std::get<std::string>( value );
+}
+
+std::optional<double> item_var_value::number() const
+{
+    if( const long long *integer = std::get_if<long long>( &value ) ) {
+        return static_cast<double>( *integer );
+    }
+    if( const double *real = std::get_if<double>( &value ) ) {
+        return *real;
+    }
+    return std::nullopt;
+}
+
+bool item_var_value::operator==( const item_var_value &rhs ) const
+{
+    if( value.index() == rhs.value.index() ) {
+        return value == rhs.value;
+    }
+    return str() == rhs.str();
+}
+
+item_var_map::const_iterator item_var_map::find( const item_var_key &key ) const
+{
+    const auto it = std::lower_bound( vars.begin(), vars.end(), key,
+    []( const value_type & var, const item_var_key & k ) {
+        return var.first < k;
+    } );
+    return it != vars.end() && it->first == key ? it : vars.end();
+}
+
+item_var_map::const_iterator item_var_map::find( const std::string &name ) const
+{
+    const std::optional<item_var_key> key = item_var_key::lookup( name );
+    return key ? find( *key ) : end();
+}
+
+void item_var_map::set( const item_var_key &key, item_var_value &&value )
+{
+    const auto it = std::lower_bound( vars.begin(), vars.end(), key,
+    []( const value_type & var, const item_var_key & k ) {
+        return var.first < k;
+    } );
+    if( it != vars.end() && it->first == key ) {
+        it->second = std::move( value );
+    } else {
+        vars.emplace( it, key, std::move( value ) );
+    }
+}
+
+void item_var_map::erase( const std::string &name )
+{
+    const const_iterator it = find( name );
+    if( it != end() ) {
+        vars.erase( it );
+    }
+}
+
+size_t item_var_map::memory_usage() const
+{
+    size_t bytes = vars.capacity() * sizeof( value_type );
+    for( const value_type &var : vars ) {
+        if( const std::string *text = var.second.text() ) {
+            bytes += string_heap_bytes( *text );
+        }
+    }
+    return bytes;
+}
+
+void item_var_map::serialize( JsonOut &jsout ) const
+{
+    // keys are ordered by interning order, sort them by name to keep saves stable
+    std::vector<const value_type *> sorted;
+    sorted.reserve( vars.size() );
+    for( const value_type &var : vars ) {
+        sorted.push_back( &var );
+    }
+    std::sort( sorted.begin(), sorted.end(), []( const value_type * lhs, const value_type * rhs ) {
+        // NOLINTNEXTLINE(cata-use-localized-sorting)
+        return lhs->first.str() < rhs->first.str();
+    } );
+    jsout.start_object();
+    for( const value_type *var : sorted ) {
+        jsout.member( var->first.str(), var->second.str() );
+    }
+    jsout.end_object();
+}
+
+void item_var_map::deserialize( const JsonValue &jv )
+{
+    vars.clear();
+    for( const JsonMember member : jv.get_object() ) {
+        if( member.test_string() ) {
+            set( member.name(), item_var_value( member.get_string() ) );
+        } else if( member.test_int() ) {
+            set( member.name(), item_var_value( static_cast<long long>( member.get_int64() ) ) );
+        } else {
+            set( member.name(), item_var_value( member.get_float() ) );
+        }
+    }
+}
@@ -0,0 +1,146 @@
+#pragma once
+#ifndef CATA_SRC_ITEM_VARS_H
+#define CATA_SRC_ITEM_VARS_H
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+class JsonOut;
+class JsonValue;
+
+/**
+ * Name of an item variable.
+ *
+ * The name is interned, keys copy and compare as a single int. Variable names come from
+ * code and game data, so the set of them stays small. Interning is not thread safe, same
+ * as for static string ids.
+ */
+class item_var_key
+{
+    public:
+        item_var_key() = default;
+        explicit item_var_key( const std::string &name );
+
+        /** Key of an already interned name, does not intern @p name if it is unknown. */
+        static std::optional<item_var_key> lookup( const std::string &name );
+
+        const std::string &str() const;
+
+        bool operator==( const item_var_key &rhs ) const {
+            return id == rhs.id;
+        }
+        bool operator!=( const item_var_key &rhs ) const {
+            return id != rhs.id;
+        }
+        /** Orders by interning order, which is not the same across game runs. */
+        bool operator<( const item_var_key &rhs ) const {
+            return id < rhs.id;
+        }
+
+    private:
+        explicit item_var_key( int interned ) : id( interned ) {}
+        int id = 0;
+};
+
+/**
+ * Value of an item variable.
+ *
+ * Item variables used to be strings only, with numbers written in a fixed format. Numbers
+ * are now kept as numbers, @ref str still gives the exact string the old storage held.
+ */
+class item_var_value
+{
+    public:
+        item_var_value() = default;
+        /** Strings that are numbers in the format @ref str writes are stored as numbers. */
+        explicit item_var_value( std::string text );
+        explicit item_var_value( long long number ) : value( number ) {}
+        /**
+         * Stored rounded to the precision @ref str writes, so the value does not change
+         * when it is saved and loaded again.
+         */
+        explicit item_var_value( double number );
+
+        std::string str() const;
+        /** The value if it is stored as a number. */
+        std::optional<double> number() const;
+        /** The value if it is stored as a string. */
+        const std::string *text() const {
+            return std::get_if<std::string>( &value );
+        }
+
+        bool operator==( const item_var_value &rhs ) const;
+        bool operator!=( const item_var_value &rhs ) const {
+            return !operator==( rhs );
+        }
+
+    private:
+        std::variant<std::string, long long, double> value;
+};
+
+/**
+ * Variables of an item, kept as a vector sorted by key.
+ *
+ * Most items have no variables, and the rest only a handful, so this does not allocate
+ * at all for the former and does a single allocation for the latter.
+ */
+class item_var_map
+{
+    public:
+        using value_type = std::pair<item_var_key, item_var_value>;
+        using const_iterator = std::vector<value_type>::const_iterator;
+
+        const_iterator begin() const {
+            return vars.begin();
+        }
+        const_iterator end() const {
+            return vars.end();
+        }
+        bool empty() const {
+            return vars.empty();
+        }
+        size_t size() const {
+            return vars.size();
+        }
+        void clear() {
+            vars.clear();
+        }
+        /** Heap bytes used by the variables. */
+        size_t memory_usage() const;
+
+        const_iterator find( const item_var_key &key ) const;
+        const_iterator find( const std::string &name ) const;
+        size_t count( const std::string &name ) const {
+            return find( name ) != end();
+        }
+
+        void set( const item_var_key &key, item_var_value &&value );
+        void set( const std::string &name, item_var_value &&value ) {
+            set( item_var_key( name ), std::move( value ) );
+        }
+        void erase( const std::string &name );
+        const_iterator erase( const_iterator it ) {
+            return vars.erase( it );
+        }
+
+        bool operator==( const item_var_map &rhs ) const {
+            return vars == rhs.vars;
+        }
+        bool operator!=( const item_var_map &rhs ) const {
+            return vars != rhs.vars;
+        }
+
+        /** Written as an object of strings sorted by name, as the old storage was. */
+        void serialize( JsonOut &jsout ) const;
+        /** Reads an object of strings or numbers. */
+        void deserialize( const JsonValue &jv );
+
+    private:
+        std::vector<value_type> vars;
+};
+
+#endif // CATA_SRC_ITEM_VARS_H
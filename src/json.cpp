@@ -2224,7 +2224,7 @@ std::string TextJsonIn::substr( size_t pos, size_t len )
 }
 
 JsonOut::JsonOut( std::ostream &s, bool pretty, int depth ) :
-    stream( &s ), pretty_print( pretty ), indent_level( depth )
+    stream( &s ), buf( s.rdbuf() ), pretty_print( pretty ), indent_level( depth )
 {
     // ensure consistent and locale-independent formatting of numerals
     stream->imbue( std::locale::classic() );
@@ -2234,6 +2234,8 @@ JsonOut::JsonOut( std::ostream &s, bool pretty, int depth ) :
 
     // automatically stringify bool to "true" or "false"
     stream->setf( std::ios_base::boolalpha );
+
+    need_wrap.reserve( 16 );
 }
 
 int JsonOut::tell()
@@ -2250,7 +2252,10 @@ void JsonOut::seek( int pos )
 
 void JsonOut::write_indent()
 {
-    std::fill_n( std::ostream_iterator<char>( *stream ), indent_level * 2, ' ' );
+    static constexpr std::string_view spaces = "                                ";
+    for( int left = indent_level * 2; left > 0; left -= spaces.size() ) {
+        put( spaces.substr( 0, std::min<size_t>( left, spaces.size() ) ) );
+    }
 }
 
 void JsonOut::write_separator()
@@ -2258,15 +2263,15 @@ void JsonOut::write_separator()
     if( !need_separator ) {
         return;
     }
-    stream->put( ',' );
+    put( ',' );
     if( pretty_print ) {
         // Wrap after separator between objects and between members of top-level objects.
         if( indent_level < 2 || need_wrap.back() ) {
-            stream->put( '\n' );
+            put( '\n' );
             write_indent();
         } else {
             // Otherwise pad after commas.
-            stream->put( ' ' );
+            put( ' ' );
         }
     }
     need_separator = false;
@@ -2275,9 +2280,9 @@ void JsonOut::write_separator()
 void JsonOut::write_member_separator()
 {
     if( pretty_print ) {
-        stream->write( ": ", 2 );
+        put( ": " );
     } else {
-        stream->put( ':' );
+        put( ':' );
     }
     need_separator = false;
 }
@@ -2288,11 +2293,11 @@ void JsonOut::start_pretty()
         indent_level += 1;
         // Wrap after top level object and array opening.
         if( indent_level < 2 || need_wrap.back() ) {
-            stream->put( '\n' );
+            put( '\n' );
             write_indent();
         } else {
             // Otherwise pad after opening.
-            stream->put( ' ' );
+            put( ' ' );
         }
     }
 }
@@ -2304,11 +2309,11 @@ void JsonOut::end_pretty()
         // Wrap after ending top level array and object.
         // Also wrap in the special case of exiting an array containing an object.
         if( indent_level < 1 || need_wrap.back() ) {
-            stream->put( '\n' );
+            put( '\n' );
             write_indent();
         } else {
             // Otherwise pad after ending.
-            stream->put( ' ' );
+            put( ' ' );
         }
     }
 }
@@ -2318,7 +2323,7 @@ void JsonOut::start_object( bool wrap )
     if( need_separator ) {
         write_separator();
     }
-    stream->put( '{' );
+    put( '{' );
     need_wrap.push_back( wrap );
     start_pretty();
     need_separator = false;
@@ -2328,7 +2333,7 @@ void JsonOut::end_object()
 {
     end_pretty();
     need_wrap.pop_back();
-    stream->put( '}' );
+    put( '}' );
     need_separator = true;
 }
 
@@ -2337,7 +2342,7 @@ void JsonOut::start_array( bool wrap )
     if( need_separator ) {
         write_separator();
     }
-    stream->put( '[' );
+    put( '[' );
     need_wrap.push_back( wrap );
     start_pretty();
     need_separator = false;
@@ -2347,7 +2352,7 @@ void JsonOut::end_array()
 {
     end_pretty();
     need_wrap.pop_back();
-    stream->put( ']' );
+    put( ']' );
     need_separator = true;
 }
 
@@ -2356,7 +2361,7 @@ void JsonOut::write_null()
     if( need_separator ) {
         write_separator();
     }
-    stream->write( "null", 4 );
+    put( "null" );
     need_separator = true;
 }
 
@@ -2365,41 +2370,44 @@ void JsonOut::write( const std::string_view val )
     if( need_separator ) {
         write_separator();
     }
-    stream->put( '"' );
-    for( const char &i : val ) {
-        unsigned char ch = i;
+    put( '"' );
+    // Characters that need no escaping, which is nearly all of them, are written in runs
+    size_t run_start = 0;
+    for( size_t i = 0; i < val.size(); ++i ) {
+        const unsigned char ch = val[i];
+        if( ch >= 0x20 && ch != '"' && ch != '\\' ) {
+            continue;
+        }
+        put( val.substr( run_start, i - run_start ) );
+        run_start = i + 1;
         if( ch == '"' ) {
-            stream->write( "\\\"", 2 );
+            put( "\\\"" );
         } else if( ch == '\\' ) {
-            stream->write( "\\\\", 2 );
-        } else if( ch == '/' ) {
-            // don't technically need to escape this
-            stream->put( '/' );
+            put( "\\\\" );
         } else if( ch == '\b' ) {
-            stream->write( "\\b", 2 );
+            put( "\\b" );
         } else if( ch == '\f' ) {
-            stream->write( "\\f", 2 );
+            put( "\\f" );
         } else if( ch == '\n' ) {
-            stream->write( "\\n", 2 );
+            put( "\\n" );
         } else if( ch == '\r' ) {
-            stream->write( "\\r", 2 );
+            put( "\\r" );
         } else if( ch == '\t' ) {
-            stream->write( "\\t", 2 );
-        } else if( ch < 0x20 ) {
+            put( "\\t" );
+        } else {
             // convert to "\uxxxx" unicode escape
-            stream->write( "\\u00", 4 );
-            stream->put( ( ch < 0x10 ) ? '0' : '1' );
+            put( "\\u00" );
+            put( ( ch < 0x10 ) ? '0' : '1' );
             char remainder = ch & 0x0F;
             if( remainder < 0x0A ) {
-                stream->put( '0' + remainder );
+                put( static_cast<char>( '0' + remainder ) );
             } else {
-                stream->put( 'A' + ( remainder - 0x0A ) );
+                put( static_cast<char>( 'A' + ( remainder - 0x0A ) ) );
             }
-        } else {
-            stream->put( ch );
         }
     }
-    stream->put( '"' );
+    put( val.substr( run_start ) );
+    put( '"' );
     need_separator = true;
 }
 
@@ -2409,13 +2417,9 @@ void JsonOut::write( const std::bitset<N> &b )
     if( need_separator ) {
         write_separator();
     }
-    std::string converted = b.to_string();
-    stream->put( '"' );
-    for( char &i : converted ) {
-        unsigned char ch = i;
-        stream->put( ch );
-    }
-    stream->put( '"' );
+    put( '"' );
+    put( b.to_string() );
+    put( '"' );
     need_separator = true;
 }
 
@@ -4,6 +4,8 @@
 
 #include <array>
 #include <bitset>
+#include <charconv>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
@@ -12,6 +14,8 @@
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -736,11 +740,60 @@ class JsonOut
 {
     private:
         std::ostream *stream;
+        // Output goes directly into the buffer of the stream, which skips the sentry and
+        // formatting machinery std::ostream runs for every single token.
+        std::streambuf *buf;
         bool pretty_print;
-        std::vector<bool> need_wrap;
+        // Per open object or array: whether its members are wrapped when pretty printing.
+        std::vector<char> need_wrap;
         int indent_level = 0;
         bool need_separator = false;
 
+        void put( const char c ) {
+            if( buf->sputc( c ) == std::char_traits<char>::eof() ) {
+                stream->setstate( std::ios::badbit );
+            }
+        }
+        void put( const std::string_view s ) {
+            if( buf->sputn( s.data(), s.size() ) != static_cast<std::streamsize>( s.size() ) ) {
+                stream->setstate( std::ios::badbit );
+            }
+        }
+
+        template <typename T>
+        void write_number( const T val ) {
+            if constexpr( std::is_floating_point_v<T> ) {
+#if defined(__cpp_lib_to_chars)
+                // The floating point overloads are missing from older standard libraries,
+                // e.g. the one of the oldest supported macOS.
+                const std::ios::fmtflags flags = stream->flags();
+                if( ( flags & std::ios::floatfield ) == std::ios::fixed ) {
+                    std::array<char, 64> chars;
+                    const int precision = static_cast<int>( stream->precision() );
+                    const std::to_chars_result res =
+                        std::to_chars( chars.data(), chars.data() + chars.size(), val,
+                                       std::chars_format::fixed, precision );
+                    if( res.ec == std::errc() ) {
+                        put( std::string_view( chars.data(), res.ptr - chars.data() ) );
+                        // like the stream, which writes the decimal point even without decimals
+                        if( precision == 0 && ( flags & std::ios::showpoint ) &&
+                            std::isfinite( val ) ) {
+                            put( '.' );
+                        }
+                        return;
+                    }
+                }
+#endif
+                // The stream is imbued with the classic locale, so this writes the same.
+                *stream << val;
+            } else {
+                std::array<char, 64> chars;
+                const std::to_chars_result res =
+                    std::to_chars( chars.data(), chars.data() + chars.size(), val );
+                put( std::string_view( chars.data(), res.ptr - chars.data() ) );
+            }
+        }
+
     public:
         explicit JsonOut( std::ostream &stream, bool pretty_print = false, int depth = 0 );
         JsonOut( const JsonOut & ) = delete;
@@ -777,7 +830,13 @@ class JsonOut
             if( need_separator ) {
                 write_separator();
             }
-            *stream << val;
+            if constexpr( std::is_same_v<T, bool> ) {
+                put( val ? std::string_view( "true" ) : std::string_view( "false" ) );
+            } else if constexpr( std::is_arithmetic_v<T> ) {
+                write_number( val );
+            } else {
+                *stream << val;
+            }
             need_separator = true;
         }
 
@@ -808,7 +867,7 @@ class JsonOut
         // strings need escaping and quoting
         void write( std::string_view val );
         void write( const char *val ) {
-            write( std::string( val ) );
+            write( std::string_view( val ) );
         }
 
         // char should always be written as an unquoted numeral
@@ -19,12 +19,18 @@ level_cache::level_cache()
     std::fill_n( &seen_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &camera_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &visibility_cache[0][0], map_dimensions, lit_level::DARK );
-    clear_vehicle_cache();
+    vehicle *veh = nullptr;
+    veh_cached_parts.fill( std::make_pair( veh, -1 ) );
+}
+
+static bool veh_cache_inbounds( const tripoint &pt )
+{
+    return pt.x >= 0 && pt.x < MAPSIZE_X && pt.y >= 0 && pt.y < MAPSIZE_Y;
 }
 
 bool level_cache::get_veh_in_active_range() const
 {
-    return !veh_cached_parts.empty();
+    return veh_cached_parts_count > 0;
 }
 
 bool level_cache::get_veh_exists_at( const tripoint &pt ) const
@@ -34,12 +40,11 @@ bool level_cache::get_veh_exists_at( const tripoint &pt ) const
 
 std::pair<vehicle *, int> level_cache::get_veh_cached_parts( const tripoint &pt ) const
 {
-    auto it = veh_cached_parts.find( pt );
-    if( it != veh_cached_parts.end() ) {
-        return it->second;
+    if( !veh_cache_inbounds( pt ) ) {
+        vehicle *veh = nullptr;
+        return std::make_pair( veh, -1 );
     }
-    vehicle *veh = nullptr;
-    return std::make_pair( veh, -1 );
+    return veh_cached_parts[pt.x][pt.y];
 }
 
 void level_cache::set_veh_exists_at( const tripoint &pt, bool exists_at )
@@ -50,8 +55,16 @@ void level_cache::set_veh_exists_at( const tripoint &pt, bool exists_at )
 
 void level_cache::set_veh_cached_parts( const tripoint &pt, vehicle &veh, int part_num )
 {
+    if( !veh_cache_inbounds( pt ) ) {
+        // parts hanging outside the bubble can't be looked up anyway
+        return;
+    }
     veh_cache_cleared = false;
-    veh_cached_parts[ pt ] = std::make_pair( &veh, part_num );
+    std::pair<vehicle *, int> &cached = veh_cached_parts[pt.x][pt.y];
+    if( cached.first == nullptr ) {
+        veh_cached_parts_count++;
+    }
+    cached = std::make_pair( &veh, part_num );
 }
 
 void level_cache::clear_vehicle_cache()
@@ -60,14 +73,20 @@ void level_cache::clear_vehicle_cache()
         return;
     }
     veh_exists_at.reset();
-    veh_cached_parts.clear();
+    vehicle *veh = nullptr;
+    veh_cached_parts.fill( std::make_pair( veh, -1 ) );
+    veh_cached_parts_count = 0;
     veh_cache_cleared = true;
 }
 
 void level_cache::clear_veh_from_veh_cached_parts( const tripoint &pt, vehicle *veh )
 {
-    auto it = veh_cached_parts.find( pt );
-    if( it != veh_cached_parts.end() && it->second.first == veh ) {
-        veh_cached_parts.erase( it );
+    if( !veh_cache_inbounds( pt ) ) {
+        return;
+    }
+    std::pair<vehicle *, int> &cached = veh_cached_parts[pt.x][pt.y];
+    if( cached.first != nullptr && cached.first == veh ) {
+        cached = std::make_pair( nullptr, -1 );
+        veh_cached_parts_count--;
     }
 }
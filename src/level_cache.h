@@ -5,11 +5,11 @@
 #include <array>
 #include <bitset>
 #include <set>
-#include <unordered_map>
 #include <utility>
 
 #include "game_constants.h"
 #include "lightmap.h"
+#include "mdarray.h"
 #include "point.h"
 #include "shadowcasting.h"
 #include "value_ptr.h"
@@ -95,6 +95,9 @@ struct level_cache {
         // since the most recent call to clear_vehicle_cache()
         bool veh_cache_cleared = true;
         std::bitset<MAPSIZE_X *MAPSIZE_Y> veh_exists_at;
-        std::unordered_map<tripoint, std::pair<vehicle *, int>> veh_cached_parts;
+        // vehicle and part index occupying each tile of the level, { nullptr, -1 } if none
+        cata::mdarray<std::pair<vehicle *, int>, point_bub_ms> veh_cached_parts;
+        // number of tiles in veh_cached_parts occupied by a vehicle
+        int veh_cached_parts_count = 0;
 };
 #endif // CATA_SRC_LEVEL_CACHE_H
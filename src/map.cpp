@@ -50,6 +50,7 @@
 #include "fungal_effects.h"
 #include "game.h"
 #include "harvest.h"
+#include "hash_utils.h"
 #include "iexamine.h"
 #include "input.h"
 #include "item.h"
@@ -1573,6 +1574,8 @@ bool map::displace_vehicle( vehicle &veh, const tripoint_rel_ms &dp, const bool
     }
 
     memory_clear_vehicle_points( veh );
+    // cables may now lead somewhere else
+    veh.invalidate_power_grid();
 
     Character &player_character = get_player_character();
     // Need old coordinates to check for remote control
@@ -8348,6 +8351,15 @@ void map::load( const tripoint_abs_sm &w, const bool update_vehicle,
     field_ter_locs.clear();
     submaps_with_active_items.clear();
     submaps_with_active_items_dirty.clear();
+    // the queued tiles are around the old location
+    pregeneration_queue.clear();
+    // Submaps are changed in place while they are on the map, so mark them before they
+    // leave it, otherwise the mapbuffer would not save them once they are outside of it.
+    for( submap *sm : grid ) {
+        if( sm != nullptr ) {
+            sm->mark_modified();
+        }
+    }
     set_abs_sub( w );
     clear_vehicle_level_caches();
     for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
@@ -8444,6 +8456,24 @@ shift_bitset_cache<MAPSIZE_X, SEEX>( std::bitset<MAPSIZE_X *MAPSIZE_X> &cache,
 template void
 shift_bitset_cache<MAPSIZE, 1>( std::bitset<MAPSIZE *MAPSIZE> &cache, const point &s );
 
+// Whether every submap of the overmap terrain tile starting at @p sm_base is in the mapbuffer.
+static bool omt_generated( const tripoint_abs_sm &sm_base )
+{
+    // It might be possible to just check the (0, 0) submap as we should never have
+    // a case where only one submap is missing from an OMT level.
+    for( int gridx = 0; gridx <= 1; gridx++ ) {
+        for( int gridy = 0; gridy <= 1; gridy++ ) {
+            for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
+                const tripoint grid_pos( gridx, gridy, gridz );
+                if( MAPBUFFER.lookup_submap( sm_base.xy() + grid_pos ) == nullptr ) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 void map::shift( const point_rel_sm &sp )
 {
     if( !zlevels ) {
@@ -8491,6 +8521,22 @@ void map::shift( const point_rel_sm &sp )
     // absx and absy are our position in the world, for saving/loading purposes.
     clear_vehicle_level_caches();
 
+    // Submaps are changed in place while they are on the map, so mark the ones on the
+    // trailing edge before they leave it, otherwise the mapbuffer would not save them.
+    for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+        for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+            const point kept( gridx - sp.x(), gridy - sp.y() );
+            if( kept.x >= 0 && kept.x < my_MAPSIZE && kept.y >= 0 && kept.y < my_MAPSIZE ) {
+                continue;
+            }
+            for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+                if( submap *const sm = get_submap_at_grid( { gridx, gridy, gridz } ) ) {
+                    sm->mark_modified();
+                }
+            }
+        }
+    }
+
     const int x_start = sp.x() >= 0 ? 0 : my_MAPSIZE - 1;
     const int x_stop = sp.x() >= 0 ? my_MAPSIZE : -1;
     const int x_step = sp.x() >= 0 ? 1 : -1;
@@ -8551,6 +8597,61 @@ void map::shift( const point_rel_sm &sp )
     for( tripoint_rel_sm loaded_grid : loaded_grids ) {
         actualize( loaded_grid );
     }
+
+    queue_pregeneration( sp );
+}
+
+void map::queue_pregeneration( const point_rel_sm &sp )
+{
+    // enough for a few shifts worth of leading edges, older entries are likely behind us by now
+    static constexpr size_t max_queued = 32;
+
+    // the ring of overmap terrain tiles just outside the loaded area
+    const point_abs_omt lo = project_to<coords::omt>( abs_sub.xy() ) + point_north_west;
+    const point_abs_omt hi = project_to<coords::omt>( abs_sub.xy() + point( my_MAPSIZE - 1,
+                             my_MAPSIZE - 1 ) ) + point_south_east;
+    for( int x = lo.x(); x <= hi.x(); x++ ) {
+        for( int y = lo.y(); y <= hi.y(); y++ ) {
+            const bool leading = ( sp.x() > 0 && x == hi.x() ) || ( sp.x() < 0 && x == lo.x() ) ||
+                                 ( sp.y() > 0 && y == hi.y() ) || ( sp.y() < 0 && y == lo.y() );
+            if( !leading ) {
+                continue;
+            }
+            const tripoint_abs_omt omt( x, y, abs_sub.z() );
+            if( std::find( pregeneration_queue.begin(), pregeneration_queue.end(),
+                           omt ) == pregeneration_queue.end() ) {
+                pregeneration_queue.push_back( omt );
+            }
+        }
+    }
+    if( pregeneration_queue.size() > max_queued ) {
+        pregeneration_queue.erase( pregeneration_queue.begin(),
+                                   pregeneration_queue.end() - max_queued );
+    }
+}
+
+bool map::pregenerate_next()
+{
+    while( !pregeneration_queue.empty() ) {
+        const tripoint_abs_omt omt = pregeneration_queue.back();
+        pregeneration_queue.pop_back();
+        if( omt_generated( project_to<coords::sm>( omt ) ) ) {
+            continue;
+        }
+        // Seeded from the tile, so that what it turns into doesn't depend on how long the
+        // game was idle, and restored after, so that the random results after don't either.
+        const cata_default_random_engine saved_engine = rng_get_engine();
+        std::size_t seed = g->get_seed();
+        cata::hash_combine( seed, omt.raw() );
+        rng_get_engine().seed( static_cast<cata_default_random_engine::result_type>( seed ) );
+        // The tile is outside of the loaded area, so nothing on the main map needs cleanup.
+        smallmap tmp_map;
+        tmp_map.main_cleanup_override( false );
+        tmp_map.generate( omt, calendar::turn, true );
+        rng_get_engine() = saved_engine;
+        return true;
+    }
+    return false;
 }
 
 void map::vertical_shift( const int newz )
@@ -8602,6 +8703,7 @@ void map::saven( const tripoint &grid )
     dbg( D_INFO ) << "map::saven abs: " << abs
                   << "  gridn: " << gridn;
     submap_to_save->last_touched = calendar::turn;
+    submap_to_save->mark_modified();
     MAPBUFFER.add_submap( abs, submap_to_save );
 }
 
@@ -8661,26 +8763,11 @@ void map::loadn( const point &grid, bool update_vehicles )
     const tripoint_abs_omt grid_abs_omt = project_to<coords::omt>( grid_abs_sub );
     // Get the base submap "grid" is an offset from.
     const tripoint_abs_sm grid_sm_base = project_to<coords::sm>( grid_abs_omt );
-    bool map_incomplete = false;
 
     bool const main_inbounds =
         this != &get_map() && get_map().inbounds( project_to<coords::ms>( grid_abs_sub ) );
 
-    // It might be possible to just check the (0, 0) submap as we should never have
-    // a case where only one submap is missing from an OMT level.
-    for( int gridx = 0; gridx <= 1; gridx++ ) {
-        for( int gridy = 0; gridy <= 1; gridy++ ) {
-            for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
-                const tripoint grid_pos( gridx, gridy, gridz );
-                if( MAPBUFFER.lookup_submap( grid_sm_base.xy() + grid_pos ) == nullptr ) {
-                    map_incomplete = true;
-                    break;
-                }
-            }
-        }
-    }
-
-    if( map_incomplete ) {
+    if( !omt_generated( grid_sm_base ) ) {
         smallmap tmp_map;
         tmp_map.main_cleanup_override( false );
         tmp_map.generate( grid_abs_omt, calendar::turn, true );
@@ -10221,6 +10308,8 @@ void map::setsubmap( const size_t grididx, submap *const smap )
         debugmsg( "Tried to set NULL submap pointer at index %d", grididx );
         return;
     }
+    // Anything in a map may be changed through it, so save the submap next time
+    smap->mark_modified();
     grid[grididx] = smap;
 }
 
@@ -540,6 +540,18 @@ class map
          * Note: the map must have been loaded before this can be called.
          */
         void shift( const point_rel_sm &s );
+        /**
+         * Generate one of the overmap terrain tiles that @ref shift queued just
+         * outside the loaded area, so that a later shift in that direction only
+         * has to fetch the submaps from the mapbuffer.
+         * Meant to be called while the game is idle, e.g. waiting for input. Each
+         * call generates at most one tile, so callers can bound the time spent.
+         * The generated tiles are kept and saved like any other, even if the player
+         * never comes close to them. They are generated with the RNG seeded from
+         * their location, so they don't depend on when they are generated.
+         * @return false if there was nothing left to generate.
+         */
+        bool pregenerate_next();
         /**
          * Moves the map vertically to (not by!) newz.
          * Does not actually shift anything, only forces cache updates.
@@ -2228,6 +2240,11 @@ class map
     protected:
         void saven( const tripoint &grid );
         void loadn( const point &grid, bool update_vehicles );
+        /**
+         * Queue the overmap terrain tiles bordering the loaded area on the
+         * side(s) the map was just shifted towards for @ref pregenerate_next.
+         */
+        void queue_pregeneration( const point_rel_sm &sp );
         /**
          * Fast forward a submap that has just been loading into this map.
          * This is used to rot and remove rotten items, grow plants, fill funnels etc.
@@ -2612,6 +2629,9 @@ class map
         // !value || value->first != map::abs_sub means cache is invalid
         std::optional<std::pair<tripoint_abs_sm, int>> max_populated_zlev = std::nullopt;
 
+        // overmap terrain tiles to generate ahead of the player, most recent last
+        std::vector<tripoint_abs_omt> pregeneration_queue;
+
         // this is set for maps loaded in bounds of the main map (g->m)
         bool _main_requires_cleanup = false;
         std::optional<bool> _main_cleanup_override = std::nullopt;
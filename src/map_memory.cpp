@@ -470,7 +470,7 @@ bool map_memory::save( const tripoint_abs_ms &pos )
                 } );
             };
 
-            const bool res = write_to_file( path, writer, descr.c_str() );
+            const bool res = write_to_save_file( path, writer, descr.c_str() );
             result = result & res;
         }
         const tripoint_abs_sm regp_sm( mmr_to_sm_copy( regp ) );
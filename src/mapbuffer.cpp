@@ -3,18 +3,21 @@
 #include <chrono>
 #include <exception>
 #include <filesystem>
+#include <functional>
 #include <set>
 #include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "async_save.h"
 #include "cata_utility.h"
 #include "debug.h"
 #include "filesystem.h"
 #include "input.h"
 #include "json.h"
 #include "map.h"
+#include "options.h"
 #include "output.h"
 #include "overmapbuffer.h"
 #include "path_info.h"
@@ -53,6 +56,8 @@ mapbuffer::~mapbuffer() = default;
 void mapbuffer::clear()
 {
     submaps.clear();
+    saved_quad_hashes.clear();
+    maptile_soa::clear_shared_layers();
 }
 
 void mapbuffer::clear_outside_reality_bubble()
@@ -66,6 +71,7 @@ void mapbuffer::clear_outside_reality_bubble()
             it = submaps.erase( it );
         }
     }
+    maptile_soa::drop_unused_shared_layers();
 }
 
 bool mapbuffer::add_submap( const tripoint_abs_sm &p, std::unique_ptr<submap> &sm )
@@ -74,6 +80,7 @@ bool mapbuffer::add_submap( const tripoint_abs_sm &p, std::unique_ptr<submap> &s
         return false;
     }
 
+    sm->share_layers();
     submaps[p] = std::move( sm );
 
     return true;
@@ -125,6 +132,15 @@ void mapbuffer::save( bool delete_after_save )
 
     int num_saved_submaps = 0;
     int num_total_submaps = submaps.size();
+    // Whatever changes after this is saved the next time
+    const uint64_t save_version = next_submap_version();
+    last_stats = save_stats();
+    const bool compress = get_option<bool>( "COMPRESS_SAVES" );
+    if( compress != saved_compressed ) {
+        // The files in the reality bubble are rewritten in the new format
+        saved_quad_hashes.clear();
+        saved_compressed = compress;
+    }
 
     map &here = get_map();
 
@@ -167,17 +183,20 @@ void mapbuffer::save( bool delete_after_save )
         // delete_on_save deletes everything, otherwise delete submaps
         // outside the current map.
         save_quad( dirname, quad_path, om_addr, submaps_to_delete,
-                   delete_after_save || !inside_reality_bubble );
+                   delete_after_save || !inside_reality_bubble, inside_reality_bubble );
         num_saved_submaps += 4;
     }
     for( auto &elem : submaps_to_delete ) {
+        saved_quad_hashes.erase( project_to<coords::omt>( elem ) );
         remove_submap( elem );
     }
+    maptile_soa::drop_unused_shared_layers();
+    saved_version = save_version;
 }
 
 void mapbuffer::save_quad(
     const cata_path &dirname, const cata_path &filename, const tripoint_abs_omt &om_addr,
-    std::list<tripoint_abs_sm> &submaps_to_delete, bool delete_after_save )
+    std::list<tripoint_abs_sm> &submaps_to_delete, bool delete_after_save, bool in_reality_bubble )
 {
     std::vector<point> offsets;
     std::vector<tripoint_abs_sm> submap_addrs;
@@ -188,6 +207,8 @@ void mapbuffer::save_quad(
 
     bool all_uniform = true;
     bool reverted_to_uniform = false;
+    // The main map changes its submaps without marking them, so those are always serialized
+    bool modified = in_reality_bubble;
     bool const file_exists = fs::exists( filename.get_unrelative_path() );
     for( point &offsets_offset : offsets ) {
         tripoint_abs_sm submap_addr = project_to<coords::sm>( om_addr );
@@ -195,6 +216,7 @@ void mapbuffer::save_quad(
         submap_addrs.push_back( submap_addr );
         submap *sm = submaps[submap_addr].get();
         if( sm != nullptr ) {
+            modified = modified || sm->modified_since( saved_version );
             if( !sm->is_uniform() ) {
                 all_uniform = false;
             } else if( sm->reverted ) {
@@ -220,10 +242,22 @@ void mapbuffer::save_quad(
         }
     }
 
-    // Don't create the directory if it would be empty
-    assure_dir_exist( dirname );
-    write_to_file( filename, [&]( std::ostream & fout ) {
-        JsonOut jsout( fout );
+    if( !modified && !all_uniform ) {
+        // Identical to the file on disk
+        ++last_stats.quads_unchanged;
+        if( delete_after_save ) {
+            for( auto &submap_addr : submap_addrs ) {
+                if( submaps.count( submap_addr ) > 0 && submaps[submap_addr] != nullptr ) {
+                    submaps_to_delete.push_back( submap_addr );
+                }
+            }
+        }
+        return;
+    }
+
+    std::ostringstream contents;
+    {
+        JsonOut jsout( contents );
         jsout.start_array();
         for( auto &submap_addr : submap_addrs ) {
             if( submaps.count( submap_addr ) == 0 ) {
@@ -257,11 +291,36 @@ void mapbuffer::save_quad(
         }
 
         jsout.end_array();
-    } );
+    }
+    const std::string data = contents.str();
 
     if( all_uniform && reverted_to_uniform ) {
-        fs::remove( filename.get_unrelative_path() );
+        assure_dir_exist( dirname );
+        write_to_save_file( filename, [&data]( std::ostream & fout ) {
+            fout << data;
+        } );
+        async_save::remove( filename.get_unrelative_path() );
+        saved_quad_hashes.erase( om_addr );
+        ++last_stats.quads_written;
+        return;
     }
+
+    // Quads in the reality bubble are serialized every time, but only rewritten if they changed
+    const size_t hash = std::hash<std::string> {}( data );
+    const auto saved_hash = saved_quad_hashes.find( om_addr );
+    if( saved_hash != saved_quad_hashes.end() && saved_hash->second == hash ) {
+        ++last_stats.quads_unchanged;
+        return;
+    }
+
+    // Don't create the directory if it would be empty
+    assure_dir_exist( dirname );
+    write_to_save_file( filename, [&data]( std::ostream & fout ) {
+        fout << data;
+    } );
+    saved_quad_hashes[om_addr] = hash;
+    ++last_stats.quads_written;
+    last_stats.bytes_written += data.size();
 }
 
 // We're reading in way too many entities here to mess around with creating sub-objects and
@@ -325,6 +384,8 @@ void mapbuffer::deserialize( const JsonArray &ja )
             }
         }
 
+        // Matches the file it came from until something changes it
+        sm->mark_saved();
         if( !add_submap( submap_coordinates, sm ) ) {
             debugmsg( "submap %s was already loaded", submap_coordinates.to_string() );
         }
@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_MAPBUFFER_H
 #define CATA_SRC_MAPBUFFER_H
 
+#include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <list>
 #include <map>
@@ -29,6 +31,17 @@ class mapbuffer
          **/
         void save( bool delete_after_save = false );
 
+        /** What the last @ref save wrote, for the debug menu. */
+        struct save_stats {
+            int quads_written = 0;
+            /** Quads that were not rewritten because nothing in them changed. */
+            int quads_unchanged = 0;
+            size_t bytes_written = 0;
+        };
+        const save_stats &last_save_stats() const {
+            return last_stats;
+        }
+
         /** Delete all buffered submaps. **/
         void clear();
 
@@ -83,8 +96,15 @@ class mapbuffer
         void save_quad(
             const cata_path &dirname, const cata_path &filename,
             const tripoint_abs_omt &om_addr, std::list<tripoint_abs_sm> &submaps_to_delete,
-            bool delete_after_save );
+            bool delete_after_save, bool in_reality_bubble );
         submap_map_t submaps; // NOLINT(cata-serialize)
+        // Submaps not modified since this version are identical to their saved copy
+        uint64_t saved_version = 0; // NOLINT(cata-serialize)
+        // Hashes of the quad files written by this instance, to skip identical rewrites
+        std::map<tripoint_abs_omt, size_t> saved_quad_hashes; // NOLINT(cata-serialize)
+        // Whether those files were compressed
+        bool saved_compressed = false; // NOLINT(cata-serialize)
+        save_stats last_stats; // NOLINT(cata-serialize)
 };
 
 extern mapbuffer MAPBUFFER;
@@ -1202,6 +1202,16 @@ jmapgen_place::jmapgen_place( const JsonObject &jsi )
 {
 }
 
+void jmapgen_piece::apply_run( const mapgendata &dat, const std::vector<tripoint_rel_ms> &points,
+                               const tripoint_rel_ms &offset, const std::string &context ) const
+{
+    for( const tripoint_rel_ms &p : points ) {
+        const tripoint_rel_ms where = p - offset;
+        apply( dat, jmapgen_int( where.x() ), jmapgen_int( where.y() ), jmapgen_int( where.z() ),
+               context );
+    }
+}
+
 void jmapgen_place::offset( const tripoint_rel_ms &offset )
 {
     x.val -= offset.x();
@@ -1327,6 +1337,10 @@ class mapgen_value
             virtual const std::string *get_name_if_parameter() const {
                 return nullptr;
             }
+            // Whether get() returns the same value for every call within one generation
+            virtual bool is_fixed_per_generation() const {
+                return true;
+            }
         };
 
         struct null_source : value_source {
@@ -1472,6 +1486,10 @@ class mapgen_value
                 return *list.pick();
             }
 
+            bool is_fixed_per_generation() const override {
+                return false;
+            }
+
             void check( const std::string &context, const mapgen_parameters & ) const override {
                 for( const weighted_object<int, StringId> &wo : list ) {
                     if( !is_valid_helper( wo.obj ) ) {
@@ -1528,6 +1546,10 @@ class mapgen_value
                 return Id( it->second );
             }
 
+            bool is_fixed_per_generation() const override {
+                return on->is_fixed_per_generation();
+            }
+
             void check( const std::string &context, const mapgen_parameters &params
                       ) const override {
                 on->check( context, params );
@@ -1653,6 +1675,10 @@ class mapgen_value
             return source_->get_name_if_parameter();
         }
 
+        bool is_fixed_per_generation() const {
+            return source_->is_fixed_per_generation();
+        }
+
         void deserialize( const JsonValue &jsin ) {
             if( jsin.test_object() ) {
                 *this = mapgen_value( jsin.get_object() );
@@ -2990,7 +3016,27 @@ class jmapgen_furniture : public jmapgen_piece
             if( chosen_id.id().is_null() ) {
                 return;
             }
-            if( !dat.m.furn_set( tripoint( x.get(), y.get(), dat.zlevel() + z.get() ), chosen_id ) ) {
+            place( dat, chosen_id, tripoint( x.get(), y.get(), dat.zlevel() + z.get() ), context );
+        }
+        void apply_run( const mapgendata &dat, const std::vector<tripoint_rel_ms> &points,
+                        const tripoint_rel_ms &offset, const std::string &context ) const override {
+            const bool fixed = id.is_fixed_per_generation();
+            const furn_id fixed_id = fixed ? id.get( dat ) : furn_id();
+            if( fixed && fixed_id.id().is_null() ) {
+                return;
+            }
+            for( const tripoint_rel_ms &p : points ) {
+                const furn_id chosen_id = fixed ? fixed_id : id.get( dat );
+                if( chosen_id.id().is_null() ) {
+                    continue;
+                }
+                const tripoint_rel_ms where = p - offset;
+                place( dat, chosen_id, tripoint( where.x(), where.y(), dat.zlevel() + where.z() ), context );
+            }
+        }
+        static void place( const mapgendata &dat, const furn_id &chosen_id, const tripoint &p,
+                           const std::string &context ) {
+            if( !dat.m.furn_set( p, chosen_id ) ) {
                 debugmsg( "Problem setting furniture in %s", context );
             }
         }
@@ -3014,6 +3060,11 @@ class jmapgen_terrain : public jmapgen_piece
         enum apply_action {
             act_unknown, act_ignore, act_dismantle, act_erase
         };
+        struct apply_actions {
+            apply_action furn = apply_action::act_unknown;
+            apply_action trap = apply_action::act_unknown;
+            apply_action item = apply_action::act_unknown;
+        };
     public:
         mapgen_value<ter_id> id;
         jmapgen_terrain( const JsonObject &jsi, const std::string_view/*context*/ ) :
@@ -3034,66 +3085,92 @@ class jmapgen_terrain : public jmapgen_piece
                 return;
             }
             tripoint p( x.get(), y.get(), dat.zlevel() + z.get() );
+            place( dat, chosen_id, p, resolve_actions( dat, context ), context );
+        }
 
-            ter_id terrain_here = dat.m.ter( p );
-            const ter_t &chosen_ter = *chosen_id;
-            const bool is_wall = chosen_ter.has_flag( ter_furn_flag::TFLAG_WALL );
-            const bool place_item = chosen_ter.has_flag( ter_furn_flag::TFLAG_PLACE_ITEM );
-            const bool is_boring_wall = is_wall && !place_item;
-
-            apply_action act_furn = apply_action::act_unknown;
-            apply_action act_trap = apply_action::act_unknown;
-            apply_action act_item = apply_action::act_unknown;
+        void apply_run( const mapgendata &dat, const std::vector<tripoint_rel_ms> &points,
+                        const tripoint_rel_ms &offset, const std::string &context ) const override {
+            const bool fixed = id.is_fixed_per_generation();
+            const ter_id fixed_id = fixed ? id.get( dat ) : ter_id();
+            if( fixed && fixed_id.id().is_null() ) {
+                return;
+            }
+            const apply_actions acts = resolve_actions( dat, context );
+            for( const tripoint_rel_ms &p : points ) {
+                const ter_id chosen_id = fixed ? fixed_id : id.get( dat );
+                if( chosen_id.id().is_null() ) {
+                    continue;
+                }
+                const tripoint_rel_ms where = p - offset;
+                place( dat, chosen_id, tripoint( where.x(), where.y(), dat.zlevel() + where.z() ), acts,
+                       context );
+            }
+        }
 
+    private:
+        // How preexisting furniture, traps and items are handled, as per the mapgen flags
+        static apply_actions resolve_actions( const mapgendata &dat, const std::string &context ) {
+            apply_actions acts;
             // shorthand flags
             if( dat.has_flag( jmapgen_flags::allow_terrain_under_other_data ) ) {
-                act_furn = apply_action::act_ignore;
-                act_trap = apply_action::act_ignore;
-                act_item = apply_action::act_ignore;
+                acts.furn = apply_action::act_ignore;
+                acts.trap = apply_action::act_ignore;
+                acts.item = apply_action::act_ignore;
             } else if( dat.has_flag( jmapgen_flags::dismantle_all_before_placing_terrain ) ) {
-                act_furn = apply_action::act_dismantle;
-                act_trap = apply_action::act_dismantle;
-                act_item = apply_action::act_ignore;
+                acts.furn = apply_action::act_dismantle;
+                acts.trap = apply_action::act_dismantle;
+                acts.item = apply_action::act_ignore;
             } else if( dat.has_flag( jmapgen_flags::erase_all_before_placing_terrain ) ) {
-                act_furn = apply_action::act_erase;
-                act_trap = apply_action::act_erase;
-                act_item = apply_action::act_erase;
+                acts.furn = apply_action::act_erase;
+                acts.trap = apply_action::act_erase;
+                acts.item = apply_action::act_erase;
             }
 
             // specific flags override shorthand flags
             if( dat.has_flag( jmapgen_flags::allow_terrain_under_furniture ) ) {
-                act_furn = apply_action::act_ignore;
+                acts.furn = apply_action::act_ignore;
             } else if( dat.has_flag( jmapgen_flags::dismantle_furniture_before_placing_terrain ) ) {
-                act_furn = apply_action::act_dismantle;
+                acts.furn = apply_action::act_dismantle;
             } else if( dat.has_flag( jmapgen_flags::erase_furniture_before_placing_terrain ) ) {
-                act_furn = apply_action::act_erase;
+                acts.furn = apply_action::act_erase;
             }
             if( dat.has_flag( jmapgen_flags::allow_terrain_under_trap ) ) {
-                act_trap = apply_action::act_ignore;
+                acts.trap = apply_action::act_ignore;
             } else if( dat.has_flag( jmapgen_flags::dismantle_trap_before_placing_terrain ) ) {
-                act_trap = apply_action::act_dismantle;
+                acts.trap = apply_action::act_dismantle;
             } else if( dat.has_flag( jmapgen_flags::erase_trap_before_placing_terrain ) ) {
-                act_trap = apply_action::act_erase;
+                acts.trap = apply_action::act_erase;
             }
             if( dat.has_flag( jmapgen_flags::allow_terrain_under_items ) ) {
-                act_item = apply_action::act_ignore;
+                acts.item = apply_action::act_ignore;
             } else if( dat.has_flag( jmapgen_flags::erase_items_before_placing_terrain ) ) {
-                act_item = apply_action::act_erase;
+                acts.item = apply_action::act_erase;
             }
 
-            if( act_item == apply_action::act_erase &&
-                ( act_furn == apply_action::act_dismantle || act_trap == apply_action::act_dismantle ) ) {
+            if( acts.item == apply_action::act_erase &&
+                ( acts.furn == apply_action::act_dismantle ||
+                  acts.trap == apply_action::act_dismantle ) ) {
                 debugmsg( "In %s on %s, the mapgen is configured to dismantle preexisting furniture "
                           "and/or traps, but will also erase preexisting items.  This is probably a "
                           "mistake, as any dismantle outputs will not be preserved.",
                           context, dat.terrain_type().id().str() );
             }
+            return acts;
+        }
+
+        static void place( const mapgendata &dat, const ter_id &chosen_id, const tripoint &p,
+                           const apply_actions &acts, const std::string &context ) {
+            ter_id terrain_here = dat.m.ter( p );
+            const ter_t &chosen_ter = *chosen_id;
+            const bool is_wall = chosen_ter.has_flag( ter_furn_flag::TFLAG_WALL );
+            const bool place_item = chosen_ter.has_flag( ter_furn_flag::TFLAG_PLACE_ITEM );
+            const bool is_boring_wall = is_wall && !place_item;
 
-            if( is_boring_wall || act_furn == apply_action::act_erase ) {
+            if( is_boring_wall || acts.furn == apply_action::act_erase ) {
                 dat.m.furn_clear( p );
                 // remove sign writing data from the submap
                 dat.m.delete_signage( p );
-            } else if( act_furn == apply_action::act_dismantle ) {
+            } else if( acts.furn == apply_action::act_dismantle ) {
                 int max_recurse = 10; // insurance against infinite looping
                 std::string initial_furn = dat.m.furn( p ) != furn_str_id::NULL_ID() ? dat.m.furn(
                                                p ).id().str() : "";
@@ -3125,27 +3202,27 @@ class jmapgen_terrain : public jmapgen_piece
                 dat.m.delete_signage( p );
             }
 
-            if( is_boring_wall || act_trap == apply_action::act_erase ) {
+            if( is_boring_wall || acts.trap == apply_action::act_erase ) {
                 dat.m.remove_trap( p );
-            } else if( act_trap == apply_action::act_dismantle ) {
+            } else if( acts.trap == apply_action::act_dismantle ) {
                 dat.m.tr_at( p ).on_disarmed( dat.m, p );
             }
 
-            if( is_boring_wall || act_item == apply_action::act_erase ) {
+            if( is_boring_wall || acts.item == apply_action::act_erase ) {
                 dat.m.i_clear( p );
             }
 
             if( chosen_id != terrain_here ) {
                 std::string error;
                 trap_str_id trap_here = dat.m.tr_at( p ).id;
-                if( act_furn != apply_action::act_ignore && dat.m.furn( p ) != furn_str_id::NULL_ID() ) {
+                if( acts.furn != apply_action::act_ignore && dat.m.furn( p ) != furn_str_id::NULL_ID() ) {
                     // NOLINTNEXTLINE(cata-translate-string-literal)
                     error = string_format( "furniture was %s", dat.m.furn( p ).id().str() );
-                } else if( act_trap != apply_action::act_ignore && !trap_here.is_null() &&
+                } else if( acts.trap != apply_action::act_ignore && !trap_here.is_null() &&
                            trap_here.id() != terrain_here->trap ) {
                     // NOLINTNEXTLINE(cata-translate-string-literal)
                     error = string_format( "trap %s existed", trap_here.str() );
-                } else if( act_item != apply_action::act_ignore && !dat.m.i_at( p ).empty() ) {
+                } else if( acts.item != apply_action::act_ignore && !dat.m.i_at( p ).empty() ) {
                     // NOLINTNEXTLINE(cata-translate-string-literal)
                     error = string_format( "item %s existed",
                                            dat.m.i_at( p ).begin()->typeId().str() );
@@ -3162,6 +3239,8 @@ class jmapgen_terrain : public jmapgen_piece
             }
             dat.m.ter_set( p, chosen_id );
         }
+
+    public:
         bool has_vehicle_collision( const mapgendata &dat, const tripoint_rel_ms &p ) const override {
             return dat.m.veh_at( tripoint_bub_ms( p.x(), p.y(), dat.zlevel() + p.z() ) ).has_value();
         }
@@ -4881,6 +4960,38 @@ void jmapgen_objects::finalize()
 {
     std::stable_sort( objects.begin(), objects.end(), compare_phases );
     objects.shrink_to_fit();
+
+    // Merge consecutive placements of the same piece at fixed positions (as
+    // produced by the rows of the mapgen) into runs.  Only consecutive
+    // objects are merged, so the order of application is unchanged.
+    const auto is_fixed = []( const jmapgen_obj & obj ) {
+        const jmapgen_place &where = obj.first;
+        const jmapgen_int &repeat = obj.second->repeat;
+        return where.x.val == where.x.valmax && where.y.val == where.y.valmax &&
+               where.z.val == where.z.valmax && where.repeat.val == 1 && where.repeat.valmax == 1 &&
+               repeat.val == 1 && repeat.valmax == 1;
+    };
+    runs.clear();
+    for( size_t first = 0; first < objects.size(); ) {
+        size_t last = first + 1;
+        if( is_fixed( objects[first] ) ) {
+            while( last < objects.size() && objects[last].second == objects[first].second &&
+                   is_fixed( objects[last] ) ) {
+                last++;
+            }
+        }
+        jmapgen_run run{ objects[first].second->phase(), first, last - first, {} };
+        if( run.count > 1 ) {
+            run.points.reserve( run.count );
+            for( size_t i = first; i < last; i++ ) {
+                const jmapgen_place &where = objects[i].first;
+                run.points.emplace_back( where.x.val, where.y.val, where.z.val );
+            }
+        }
+        runs.push_back( std::move( run ) );
+        first = last;
+    }
+    runs.shrink_to_fit();
 }
 
 void jmapgen_objects::check( const std::string &context, const mapgen_parameters &parameters ) const
@@ -5418,13 +5529,12 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase,
 {
     bool terrain_resolved = false;
 
-    auto range_at_phase = std::equal_range( objects.begin(), objects.end(), phase, compare_phases );
-
-    for( auto it = range_at_phase.first; it != range_at_phase.second; ++it ) {
-        const jmapgen_obj &obj = *it;
-        jmapgen_place where = obj.first;
-        where.offset( tripoint_rel_ms( -offset.raw() ) );
-        const jmapgen_piece &what = *obj.second;
+    const auto run_before = []( const jmapgen_run & run, mapgen_phase p ) {
+        return run.phase < p;
+    };
+    for( auto run = std::lower_bound( runs.begin(), runs.end(), phase, run_before );
+         run != runs.end() && run->phase == phase; ++run ) {
+        const jmapgen_piece &what = *objects[run->first].second;
 
         cata_assert( what.phase() == phase );
 
@@ -5437,6 +5547,14 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase,
             terrain_resolved = true;
         }
 
+        if( !run->points.empty() ) {
+            what.apply_run( dat, run->points, offset, context );
+            continue;
+        }
+
+        jmapgen_place where = objects[run->first].first;
+        where.offset( tripoint_rel_ms( -offset.raw() ) );
+
         // The user will only specify repeat once in JSON, but it may get loaded both
         // into the what and where in some cases--we just need the greater value of the two.
         const int repeat = std::max( where.repeat.get(), what.repeat.get() );
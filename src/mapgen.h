@@ -242,6 +242,13 @@ class jmapgen_piece
         virtual void apply( const mapgendata &dat, const jmapgen_int &x, const jmapgen_int &y,
                             const jmapgen_int &z,
                             const std::string &context ) const = 0;
+        /**
+         * Place something at each of @p points (minus @p offset), in order.
+         * Same as calling @ref apply for each point; pieces may override it to
+         * resolve their values once for the whole run.
+         */
+        virtual void apply_run( const mapgendata &dat, const std::vector<tripoint_rel_ms> &points,
+                                const tripoint_rel_ms &offset, const std::string &context ) const;
         virtual ~jmapgen_piece() = default;
         jmapgen_int repeat;
         virtual bool has_vehicle_collision( const mapgendata &, const tripoint_rel_ms &/*offset*/ ) const {
@@ -434,6 +441,19 @@ struct jmapgen_objects {
          */
         using jmapgen_obj = std::pair<jmapgen_place, shared_ptr_fast<const jmapgen_piece> >;
         std::vector<jmapgen_obj> objects;
+        /**
+         * A range of @ref objects applied together, built by @ref finalize.
+         * Consecutive placements of one piece at fixed positions are merged
+         * into a single run applied with @ref jmapgen_piece::apply_run.
+         */
+        struct jmapgen_run {
+            mapgen_phase phase;
+            size_t first;
+            size_t count;
+            // positions of a merged run, empty if it is a single object
+            std::vector<tripoint_rel_ms> points;
+        };
+        std::vector<jmapgen_run> runs;
         tripoint_rel_ms m_offset;
         point mapgensize;
         point total_size;
@@ -1,6 +1,7 @@
 #include "math_parser.h"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <locale>
 #include <map>
@@ -190,6 +191,11 @@ std::vector<double> _eval_params( std::vector<thingie> const &params, dialogue &
     return elems;
 }
 
+bool is_constant( thingie const &thing )
+{
+    return std::holds_alternative<double>( thing.data );
+}
+
 constexpr void _validate_operand( thingie const &thing, std::string_view symbol )
 {
     if( std::holds_alternative<std::string>( thing.data ) ) {
@@ -231,6 +237,10 @@ double func_jmath::eval( dialogue &d ) const
 
 double var::eval( dialogue &d ) const
 {
+    if( std::optional<double> ret = maybe_read_var_num( varinfo, d ); ret ) {
+        return *ret;
+    }
+    // missing or non-numeric, let the string path handle defaults and errors
     std::string const str = read_var_value( varinfo, d );
     if( str.empty() ) {
         return 0;
@@ -266,11 +276,170 @@ double ternary::eval( dialogue &d ) const
     return cond->eval( d ) > 0 ? mhs->eval( d ) : rhs->eval( d );
 }
 
+void math_program::_emit( math_instr const &ins, std::ptrdiff_t stack_delta )
+{
+    code.emplace_back( ins );
+    depth = static_cast<std::size_t>( static_cast<std::ptrdiff_t>( depth ) + stack_delta );
+    max_depth = std::max( max_depth, depth );
+}
+
+bool math_program::_compile( thingie const &t )
+{
+    math_instr ins;
+    return std::visit( overloaded{
+        [this, &ins]( double v )
+        {
+            ins.op = math_instr::code::push;
+            ins.val = v;
+            _emit( ins, 1 );
+            return true;
+        },
+        [this, &ins]( var const & v )
+        {
+            ins.op = math_instr::code::load;
+            ins.idx = vars.size();
+            vars.emplace_back( v );
+            _emit( ins, 1 );
+            return true;
+        },
+        [this, &ins]( oper const & v )
+        {
+            if( !_compile( *v.l ) || !_compile( *v.r ) ) {
+                return false;
+            }
+            ins.op = math_instr::code::bin_op;
+            ins.bin = v.op;
+            _emit( ins, -1 );
+            return true;
+        },
+        [this, &ins]( func const & v )
+        {
+            for( thingie const &param : v.params ) {
+                if( !_compile( param ) ) {
+                    return false;
+                }
+            }
+            ins.op = math_instr::code::call;
+            ins.f = v.f;
+            ins.nargs = v.params.size();
+            _emit( ins, 1 - static_cast<std::ptrdiff_t>( ins.nargs ) );
+            return true;
+        },
+        [this, &ins]( func_jmath const & v )
+        {
+            for( thingie const &param : v.params ) {
+                if( !_compile( param ) ) {
+                    return false;
+                }
+            }
+            ins.op = math_instr::code::call_jmath;
+            ins.idx = jmaths.size();
+            jmaths.emplace_back( v.id );
+            ins.nargs = v.params.size();
+            _emit( ins, 1 - static_cast<std::ptrdiff_t>( ins.nargs ) );
+            return true;
+        },
+        [this, &ins]( func_diag_eval const & v )
+        {
+            ins.op = math_instr::code::call_diag;
+            ins.idx = diags.size();
+            diags.emplace_back( v.f );
+            _emit( ins, 1 );
+            return true;
+        },
+        [this, &ins]( ternary const & v )
+        {
+            if( !_compile( *v.cond ) ) {
+                return false;
+            }
+            std::size_t const skip_mhs = code.size();
+            ins.op = math_instr::code::jump_if_false;
+            _emit( ins, -1 );
+            if( !_compile( *v.mhs ) ) {
+                return false;
+            }
+            std::size_t const skip_rhs = code.size();
+            ins.op = math_instr::code::jump;
+            // rhs starts from the same stack depth as mhs did
+            _emit( ins, -1 );
+            code[skip_mhs].idx = code.size();
+            if( !_compile( *v.rhs ) ) {
+                return false;
+            }
+            code[skip_rhs].idx = code.size();
+            return true;
+        },
+        []( auto const &/* v */ )
+        {
+            // strings, kwargs, arrays and assignment functions have no numeric value
+            return false;
+        },
+    },
+    t.data );
+}
+
+bool math_program::compile( thingie const &tree )
+{
+    *this = math_program();
+    if( !_compile( tree ) || max_depth > max_stack ) {
+        *this = math_program();
+        return false;
+    }
+    return true;
+}
+
+double math_program::eval( dialogue &d ) const
+{
+    std::array<double, max_stack> stack{};
+    std::size_t top = 0;
+    std::vector<double> args;
+    for( std::size_t pc = 0; pc < code.size(); ) {
+        math_instr const &ins = code[pc++];
+        switch( ins.op ) {
+            case math_instr::code::push:
+                stack[top++] = ins.val;
+                break;
+            case math_instr::code::load:
+                stack[top++] = vars[ins.idx].eval( d );
+                break;
+            case math_instr::code::bin_op:
+                top--;
+                stack[top - 1] = ins.bin( stack[top - 1], stack[top] );
+                break;
+            case math_instr::code::call:
+                top -= ins.nargs;
+                args.assign( stack.data() + top, stack.data() + top + ins.nargs );
+                stack[top++] = ins.f( args );
+                break;
+            case math_instr::code::call_jmath:
+                top -= ins.nargs;
+                args.assign( stack.data() + top, stack.data() + top + ins.nargs );
+                stack[top++] = jmaths[ins.idx]->eval( d, args );
+                break;
+            case math_instr::code::call_diag:
+                stack[top++] = diags[ins.idx]( d );
+                break;
+            case math_instr::code::jump_if_false:
+                top--;
+                if( !( stack[top] > 0 ) ) {
+                    pc = ins.idx;
+                }
+                break;
+            case math_instr::code::jump:
+                pc = ins.idx;
+                break;
+        }
+    }
+    return stack[0];
+}
+
 class math_exp::math_exp_impl
 {
     public:
         math_exp_impl() = default;
-        explicit math_exp_impl( thingie &&t ): tree( t ) {}
+        explicit math_exp_impl( thingie &&t ): tree( t ) {
+            program.compile( tree );
+        }
 
         bool parse( std::string_view str, bool assignment ) {
             if( str.empty() ) {
@@ -288,12 +457,14 @@ class math_exp::math_exp_impl
                 output = {};
                 arity = {};
                 tree = thingie { 0.0 };
+                program = {};
                 return false;
             }
+            program.compile( tree );
             return true;
         }
         double eval( dialogue &d ) const {
-            return tree.eval( d );
+            return program.empty() ? tree.eval( d ) : program.eval( d );
         }
 
         void assign( dialogue &d, double val ) const {
@@ -337,6 +508,7 @@ class math_exp::math_exp_impl
         };
         std::stack<arity_t> arity;
         thingie tree{ 0.0 };
+        math_program program;
         std::string_view last_token;
         parse_state state;
 
@@ -621,7 +793,15 @@ void math_exp::math_exp_impl::new_func()
             },
             [&params, this]( pmath_func v )
             {
-                output.emplace( std::in_place_type_t<func>(), std::move( params ), v->f );
+                if( v->deterministic && std::all_of( params.begin(), params.end(), is_constant ) ) {
+                    std::vector<double> vals( params.size() );
+                    std::transform( params.begin(), params.end(), vals.begin(), []( thingie const & e ) {
+                        return std::get<double>( e.data );
+                    } );
+                    output.emplace( v->f( vals ) );
+                } else {
+                    output.emplace( std::in_place_type_t<func>(), std::move( params ), v->f );
+                }
             },
             [&params, this]( jmath_func_id const & v )
             {
@@ -702,7 +882,11 @@ void math_exp::math_exp_impl::new_ternary( thingie &lhs, thingie &rhs )
     thingie cond = std::move( output.top() );
     _validate_operand( cond, "?:" );
     output.pop();
-    output.emplace( std::in_place_type_t<ternary>(), cond, lhs, rhs );
+    if( is_constant( cond ) ) {
+        output.push( std::move( std::get<double>( cond.data ) > 0 ? lhs : rhs ) );
+    } else {
+        output.emplace( std::in_place_type_t<ternary>(), cond, lhs, rhs );
+    }
 }
 
 void math_exp::math_exp_impl::new_array()
@@ -749,7 +933,11 @@ void math_exp::math_exp_impl::new_oper()
             } else {
                 _validate_operand( lhs, v->symbol );
                 _validate_operand( rhs, v->symbol );
-                output.emplace( std::in_place_type_t<oper>(), lhs, rhs, v->f );
+                if( is_constant( lhs ) && is_constant( rhs ) ) {
+                    output.emplace( v->f( std::get<double>( lhs.data ), std::get<double>( rhs.data ) ) );
+                } else {
+                    output.emplace( std::in_place_type_t<oper>(), lhs, rhs, v->f );
+                }
             }
         },
         [this]( punary_op v )
@@ -758,7 +946,11 @@ void math_exp::math_exp_impl::new_oper()
             thingie rhs = std::move( output.top() );
             output.pop();
             _validate_operand( rhs, v->symbol );
-            output.emplace( std::in_place_type_t<oper>(), thingie { 0.0 }, rhs, v->f );
+            if( is_constant( rhs ) ) {
+                output.emplace( v->f( 0.0, std::get<double>( rhs.data ) ) );
+            } else {
+                output.emplace( std::in_place_type_t<oper>(), thingie { 0.0 }, rhs, v->f );
+            }
         },
         []( auto /* v */ )
         {
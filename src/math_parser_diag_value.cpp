@@ -83,6 +83,9 @@ double diag_value::dbl( dialogue const &d ) const
         },
         [&d]( var_info const & v )
         {
+            if( std::optional<double> ret = maybe_read_var_num( v, d ); ret ) {
+                return *ret;
+            }
             std::string const val = read_var_value( v, d );
             if( std::optional<double> ret = svtod( val ); ret ) {
                 return *ret;
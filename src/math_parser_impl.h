@@ -4,6 +4,7 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -179,6 +180,53 @@ constexpr double thingie::eval( dialogue &d ) const
     data );
 }
 
+// Flattened postfix form of a thingie tree, evaluated on a value stack instead of
+// recursing through the variant nodes.
+struct math_instr {
+    enum class code : int {
+        push = 0,     // push val
+        load,         // push the value of vars[idx]
+        bin_op,       // pop r, pop l, push bin( l, r )
+        call,         // pop nargs args, push f( args )
+        call_jmath,   // pop nargs args, push jmaths[idx]->eval( d, args )
+        call_diag,    // push diags[idx]( d )
+        jump_if_false, // pop cond, jump to idx unless cond > 0
+        jump,         // jump to idx
+    };
+    code op = code::push;
+    double val = 0;
+    binary_op::f_t bin = nullptr;
+    math_func::f_t f = nullptr;
+    std::size_t idx = 0;
+    std::size_t nargs = 0;
+};
+
+class math_program
+{
+    public:
+        // deeper expressions fall back to the tree walker
+        static constexpr std::size_t max_stack = 32;
+
+        bool empty() const {
+            return code.empty();
+        }
+        // returns false and leaves the program empty if the tree contains nodes
+        // that cannot be evaluated as a number
+        bool compile( thingie const &tree );
+        double eval( dialogue &d ) const;
+
+    private:
+        std::vector<math_instr> code;
+        std::vector<var> vars;
+        std::vector<jmath_func_id> jmaths;
+        std::vector<func_diag_eval::eval_f> diags;
+        std::size_t depth = 0;
+        std::size_t max_depth = 0;
+
+        bool _compile( thingie const &t );
+        void _emit( math_instr const &ins, std::ptrdiff_t stack_delta );
+};
+
 using op_t =
     std::variant<pbin_op, punary_op, pmath_func, jmath_func_id, scoped_diag_eval, scoped_diag_ass, paren>;
 
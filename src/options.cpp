@@ -2816,6 +2816,11 @@ void options_manager::add_options_world_default()
              to_translation( "If true, spawn zombies at shelters.  Makes the starting game a lot harder." ),
              false
            );
+
+        add( "COMPRESS_SAVES", page_id, to_translation( "Compress save files" ),
+             to_translation( "If true, map, overmap and map memory files are gzip compressed when saved.  This makes the world use much less disk space, which speeds up saving and loading on slow disks.  Files are loaded regardless of whether they are compressed, so this can be changed at any time." ),
+             false
+           );
     } );
 
     add_empty_line();
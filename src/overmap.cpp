@@ -6,11 +6,14 @@
 #include <cmath>
 #include <cstring>
 #include <exception>
+#include <functional>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <ostream>
 #include <set>
+#include <sstream>
+#include <string>
 #include <unordered_set>
 #include <vector>
 
@@ -7349,15 +7352,36 @@ void overmap::open( overmap_special_batch &enabled_specials )
 }
 
 // Note: this may throw io errors from std::ofstream
-void overmap::save() const
-{
-    write_to_file( overmapbuffer::player_filename( loc ), [&]( std::ostream & stream ) {
+size_t overmap::save()
+{
+    size_t bytes_written = 0;
+    // Hordes, npcs and the like change whenever they please, so rather than tracking
+    // every change the files are serialized and only written if they differ.
+    const auto write_if_changed = [&bytes_written]( const cata_path & path, size_t &saved_hash,
+    const std::function<void( std::ostream & )> &serializer ) {
+        std::ostringstream contents;
+        serializer( contents );
+        const std::string data = contents.str();
+        const size_t hash = std::hash<std::string> {}( data );
+        if( hash == saved_hash ) {
+            return;
+        }
+        write_to_save_file( path, [&data]( std::ostream & stream ) {
+            stream << data;
+        } );
+        saved_hash = hash;
+        bytes_written += data.size();
+    };
+
+    write_if_changed( overmapbuffer::player_filename( loc ), saved_hashes[0],
+    [&]( std::ostream & stream ) {
         serialize_view( stream );
     } );
-
-    write_to_file( overmapbuffer::terrain_filename( loc ), [&]( std::ostream & stream ) {
+    write_if_changed( overmapbuffer::terrain_filename( loc ), saved_hashes[1],
+    [&]( std::ostream & stream ) {
         serialize( stream );
     } );
+    return bytes_written;
 }
 
 void overmap::spawn_mon_group( const mongroup &group, int radius )
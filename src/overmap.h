@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <climits>
+#include <cstddef>
 #include <cstdlib>
 #include <functional>
 #include <iosfwd>
@@ -204,7 +205,11 @@ class overmap
             return urbanity;
         }
 
-        void save() const;
+        /**
+         * Writes the overmap files whose contents changed since this overmap last saved them.
+         * @return The number of bytes written.
+         */
+        size_t save();
 
         /**
          * @return The (local) overmap terrain coordinates of a randomly
@@ -347,6 +352,8 @@ class overmap
         // overmap::seen and overmap::explored
         bool nullbool = false; // NOLINT(cata-serialize)
         point_abs_om loc; // NOLINT(cata-serialize)
+        // Hashes of the player and terrain files as last saved, 0 if not saved yet
+        std::array<size_t, 2> saved_hashes = {}; // NOLINT(cata-serialize)
         // Random point used for special connections if there's no cities on the overmap, joins to all roads_out
         std::optional<point_om_omt> fallback_road_connection_point; // NOLINT(cata-serialize)
 
@@ -227,9 +227,16 @@ void overmapbuffer::fix_npcs( overmap &new_overmap )
 
 void overmapbuffer::save()
 {
+    last_stats = save_stats();
     for( auto &omp : overmaps ) {
         // Note: this may throw io errors from std::ofstream
-        omp.second->save();
+        const size_t bytes = omp.second->save();
+        if( bytes > 0 ) {
+            ++last_stats.overmaps_written;
+            last_stats.bytes_written += bytes;
+        } else {
+            ++last_stats.overmaps_unchanged;
+        }
     }
 }
 
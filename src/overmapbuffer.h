@@ -3,6 +3,7 @@
 #define CATA_SRC_OVERMAPBUFFER_H
 
 #include <array>
+#include <cstddef>
 #include <functional>
 #include <iosfwd>
 #include <memory>
@@ -155,6 +156,17 @@ class overmapbuffer
          */
         overmap &get( const point_abs_om & );
         void save();
+
+        /** What the last @ref save wrote, for the debug menu. */
+        struct save_stats {
+            int overmaps_written = 0;
+            /** Overmaps that were not rewritten because nothing in them changed. */
+            int overmaps_unchanged = 0;
+            size_t bytes_written = 0;
+        };
+        const save_stats &last_save_stats() const {
+            return last_stats;
+        }
         /**
          * Just drop the generated overmaps without resetting
          * the members tracking which specials we've placed.
@@ -547,6 +559,7 @@ class overmapbuffer
         bool is_findable_location( const tripoint_abs_omt &location, const omt_find_params &params );
 
         std::unordered_map< point_abs_om, std::unique_ptr< overmap > > overmaps;
+        save_stats last_stats;
         /**
          * Set of overmap coordinates of overmaps that are known
          * to not exist on disk. See @ref get_existing for usage.
@@ -6,6 +6,7 @@
 #include <array>
 #include <bitset>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <iterator>
@@ -15,6 +16,7 @@
 #include <vector>
 
 #include "cached_options.h"
+#include "calendar.h"
 #include "cata_assert.h"
 #include "cata_utility.h"
 #include "cata_tiles.h"
@@ -33,6 +35,7 @@
 #include "monster.h"
 #include "pixel_minimap_projectors.h"
 #include "sdl_utils.h"
+#include "submap.h"
 #include "vehicle.h"
 #include "vpart_position.h"
 
@@ -165,8 +168,26 @@ class pixel_minimap::shared_texture_pool
 };
 
 struct pixel_minimap::submap_cache {
+    //everything the colors of a submap are computed from; the colors are only
+    //recomputed when this changes
+    struct source {
+        const submap *sm = nullptr;
+        uint64_t version = 0;
+        //terrain and furniture colors are seasonal
+        season_type season = SPRING;
+        bool nv_goggle = false;
+        std::array<lit_level, SEEX *SEEY> lighting = {};
+
+        bool operator==( const source &rhs ) const {
+            return sm == rhs.sm && version == rhs.version && season == rhs.season &&
+                   nv_goggle == rhs.nv_goggle && lighting == rhs.lighting;
+        }
+    };
+
     //the color stored for each submap tile
     std::array<SDL_Color, SEEX *SEEY> minimap_colors = {};
+    //the state the colors were last computed from, if it is known to be complete
+    std::optional<source> computed_from;
     //checks if the submap has been looked at by the minimap routine
     bool touched = false;
     //the texture updates are drawn to
@@ -230,17 +251,23 @@ void pixel_minimap::set_settings( const pixel_minimap_settings &settings )
 void pixel_minimap::prepare_cache_for_updates( const tripoint &center )
 {
     // TODO: fix point types
-    const tripoint new_center_sm = get_map().get_abs_sub().raw() + ms_to_sm_copy( center );
-    const tripoint center_sm_diff = cached_center_sm - new_center_sm;
+    const tripoint abs_sub = get_map().get_abs_sub().raw();
+    const tripoint new_center_sm = abs_sub + ms_to_sm_copy( center );
 
-    //invalidate the cache if the game shifted more than one submap in the last update, or if z-level changed.
-    if( std::abs( center_sm_diff.x ) > 1 ||
-        std::abs( center_sm_diff.y ) > 1 ||
-        std::abs( center_sm_diff.z ) > 0 ) {
+    //invalidate the cache if the z-level changed
+    if( cached_center_sm.z != new_center_sm.z ) {
         cache.clear();
     } else {
-        for( auto &mcp : cache ) {
-            mcp.second.touched = false;
+        //keep the submaps still in the map after it shifted, however far it moved;
+        //dropping the others first keeps the texture pool from running out
+        for( auto it = cache.begin(); it != cache.end(); ) {
+            const tripoint rel = it->first - abs_sub;
+            if( rel.x < 0 || rel.x >= MAPSIZE || rel.y < 0 || rel.y >= MAPSIZE ) {
+                it = cache.erase( it );
+            } else {
+                it->second.touched = false;
+                ++it;
+            }
         }
     }
 
@@ -313,10 +340,35 @@ void pixel_minimap::update_cache_at( const tripoint &sm_pos )
 
     cache_item.touched = true;
 
+    //the colors only depend on terrain and furniture, vehicles and lighting, so skip
+    //the submap if none of them changed since it was last computed
+    submap_cache::source source;
+    source.sm = here.get_submap_at_grid( tripoint_rel_sm( sm_pos ) );
+    source.version = source.sm ? source.sm->layers_version() : 0;
+    source.season = season_of_year( calendar::turn );
+    source.nv_goggle = nv_goggle;
+    //vehicles move without changing the submap, so those are always recomputed
+    bool has_vehicle = false;
     for( int y = 0; y < SEEY; ++y ) {
         for( int x = 0; x < SEEX; ++x ) {
             const tripoint p = ms_pos + tripoint{ x, y, 0 };
-            const lit_level lighting = access_cache.visibility_cache[p.x][p.y];
+            source.lighting[y * SEEX + x] = access_cache.visibility_cache[p.x][p.y];
+            has_vehicle = has_vehicle || access_cache.get_veh_exists_at( p );
+        }
+    }
+    if( cache_item.computed_from == source ) {
+        return;
+    }
+    if( has_vehicle || !source.sm ) {
+        cache_item.computed_from.reset();
+    } else {
+        cache_item.computed_from = source;
+    }
+
+    for( int y = 0; y < SEEY; ++y ) {
+        for( int x = 0; x < SEEX; ++x ) {
+            const tripoint p = ms_pos + tripoint{ x, y, 0 };
+            const lit_level lighting = source.lighting[y * SEEX + x];
 
             SDL_Color color;
 
@@ -1497,16 +1497,14 @@ void Character::store( JsonOut &json ) const
     json.member( "suppress_autohaul", suppress_autohaul );
 
     //save queued effect_on_conditions
-    queued_eocs temp_queued( queued_effect_on_conditions );
     json.member( "queued_effect_on_conditions" );
     json.start_array();
-    while( !temp_queued.empty() ) {
+    for( const queued_eoc &queued : queued_effect_on_conditions.list ) {
         json.start_object();
-        json.member( "time", temp_queued.top().time );
-        json.member( "eoc", temp_queued.top().eoc );
-        json.member( "context", temp_queued.top().context );
+        json.member( "time", queued.time );
+        json.member( "eoc", queued.eoc );
+        json.member( "context", queued.context );
         json.end_object();
-        temp_queued.pop();
     }
 
     json.end_array();
@@ -2805,6 +2803,9 @@ void item::io( Archive &archive )
     archive.io( "mission_id", mission_id, -1 );
     archive.io( "player_id", player_id, -1 );
     archive.io( "item_vars", item_vars, io::empty_default_tag() );
+    // corpse name and techniques live in the cold data, which is only allocated when needed
+    std::string corpse_name = cold().corpse_name;
+    std::set<matec_id> techniques = cold().techniques;
     // TODO: change default to empty string
     archive.io( "name", corpse_name, std::string() );
     archive.io( "owner", owner, faction_id::NULL_ID() );
@@ -2822,6 +2823,10 @@ void item::io( Archive &archive )
     archive.io( "last_temp_check", last_temp_check, calendar::start_of_cataclysm );
     archive.io( "current_phase", cur_phase, static_cast<int>( type->phase ) );
     archive.io( "techniques", techniques, io::empty_default_tag() );
+    if( Archive::is_input::value && ( cold_ || !corpse_name.empty() || !techniques.empty() ) ) {
+        edit_cold().corpse_name = std::move( corpse_name );
+        edit_cold().techniques = std::move( techniques );
+    }
     archive.io( "faults", faults, io::empty_default_tag() );
     archive.io( "item_tags", item_tags, io::empty_default_tag() );
     archive.io( "components", components, io::empty_default_tag() );
@@ -2961,8 +2966,8 @@ void item::io( Archive &archive )
     // counter, it will always be 0 and it prevents proper stacking.
     if( get_chapters() == 0 ) {
         for( auto it = item_vars.begin(); it != item_vars.end(); ) {
-            if( it->first.compare( 0, 19, "remaining-chapters-" ) == 0 ) {
-                item_vars.erase( it++ );
+            if( it->first.str().compare( 0, 19, "remaining-chapters-" ) == 0 ) {
+                it = item_vars.erase( it );
             } else {
                 ++it;
             }
@@ -4665,7 +4670,7 @@ void submap::store( JsonOut &jsout ) const
     for( int j = 0; j < SEEY; j++ ) {
         // NOLINTNEXTLINE(modernize-loop-convert)
         for( int i = 0; i < SEEX; i++ ) {
-            const std::string this_id = m->ter[i][j].obj().id.str();
+            const std::string this_id = m->layers().ter[i][j].obj().id.str();
             if( !last_id.empty() ) {
                 if( this_id == last_id ) {
                     num_same++;
@@ -4885,26 +4890,26 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
                     const ter_str_id tid( terrain_json.next_string() );
 
                     if( tid == ter_t_rubble ) {
-                        m->ter[i][j] = ter_t_dirt;
-                        m->frn[i][j] = furn_id( "f_rubble" );
+                        m->mutable_layers().ter[i][j] = ter_t_dirt;
+                        m->mutable_layers().frn[i][j] = furn_id( "f_rubble" );
                         m->itm[i][j].insert( rock );
                         m->itm[i][j].insert( rock );
                     } else if( tid == ter_t_wreckage ) {
-                        m->ter[i][j] = ter_t_dirt;
-                        m->frn[i][j] = furn_id( "f_wreckage" );
+                        m->mutable_layers().ter[i][j] = ter_t_dirt;
+                        m->mutable_layers().frn[i][j] = furn_id( "f_wreckage" );
                         m->itm[i][j].insert( chunk );
                         m->itm[i][j].insert( chunk );
                     } else if( tid == ter_t_ash ) {
-                        m->ter[i][j] = ter_t_dirt;
-                        m->frn[i][j] = furn_id( "f_ash" );
+                        m->mutable_layers().ter[i][j] = ter_t_dirt;
+                        m->mutable_layers().frn[i][j] = furn_id( "f_ash" );
                     } else if( tid == ter_t_pwr_sb_support_l ) {
-                        m->ter[i][j] = ter_t_support_l;
+                        m->mutable_layers().ter[i][j] = ter_t_support_l;
                     } else if( tid == ter_t_pwr_sb_switchgear_l ) {
-                        m->ter[i][j] = ter_t_switchgear_l;
+                        m->mutable_layers().ter[i][j] = ter_t_switchgear_l;
                     } else if( tid == ter_t_pwr_sb_switchgear_s ) {
-                        m->ter[i][j] = ter_t_switchgear_s;
+                        m->mutable_layers().ter[i][j] = ter_t_switchgear_s;
                     } else {
-                        m->ter[i][j] = tid.id();
+                        m->mutable_layers().ter[i][j] = tid.id();
                     }
                 }
             }
@@ -4947,9 +4952,9 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
                     } else {
                         --remaining;
                     }
-                    m->ter[i][j] = iid_ter;
+                    m->mutable_layers().ter[i][j] = iid_ter;
                     if( iid_furn ) {
-                        m->frn[i][j] = iid_furn;
+                        m->mutable_layers().frn[i][j] = iid_furn;
                     }
                 }
             }
@@ -4981,7 +4986,7 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
             if( auto it = furn_migrations.find( furnstr ); it != furn_migrations.end() ) {
                 furnstr = it->second.second;
                 if( it->second.first != ter_str_id::NULL_ID() ) {
-                    m->ter[i][j] = it->second.first.id();
+                    m->mutable_layers().ter[i][j] = it->second.first.id();
                 }
             }
             if( furnstr.is_valid() ) {
@@ -4990,7 +4995,7 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
                 debugmsg( "invalid furn_str_id '%s'", furnstr.c_str() );
                 iid_furn = furn_str_id::NULL_ID().id();
             }
-            m->frn[i][j] = iid_furn;
+            m->mutable_layers().frn[i][j] = iid_furn;
             if( furniture_entry.size() > 3 ) {
                 furniture_entry.throw_error( "Too many values for furniture entry." );
             }
@@ -5021,12 +5026,12 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
             const point p( i, j );
             // TODO: jsin should support returning an id like jsin.get_id<trap>()
             const trap_str_id trid( trap_entry.next_string() );
-            m->trp[p.x][p.y] = trid.id();
+            m->mutable_layers().trp[p.x][p.y] = trid.id();
             if( trap_entry.has_more() ) {
                 std::optional<std::string> trap_item_type = std::nullopt;
                 trap_entry.read_next( trap_item_type );
                 if( trap_item_type.has_value() ) {
-                    const_cast<trap &>( m->trp[p.x][p.y].obj() ).set_trap_data( itype_id( trap_item_type.value() ) );
+                    const_cast<trap &>( m->layers().trp[p.x][p.y].obj() ).set_trap_data( itype_id( trap_item_type.value() ) );
                 }
             }
             if( trap_entry.size() > 4 ) {
@@ -33,6 +33,7 @@
 #endif
 #endif
 
+#include "async_save.h"
 #include "avatar.h"
 #include "cached_options.h"
 #include "cata_assert.h"
@@ -2918,6 +2919,8 @@ static void CheckMessages()
                             get_option<bool>( "ANDROID_QUICKSAVE" ) &&
                             !std::uncaught_exception() ) {
                             g->quicksave();
+                            // the app may be killed at any moment now
+                            async_save::wait_all();
                         }
                         break;
                     // SDL sends a window size changed event whenever the screen rotates orientation
@@ -3473,6 +3476,13 @@ static void CheckMessages()
     // resizing already reinitializes the render target
     if( !resized && render_target_reset ) {
         throwErrorIf( !SetupRenderTarget(), "SetupRenderTarget failed" );
+        // the retained map layers were render targets too
+        if( closetilecontext ) {
+            closetilecontext->invalidate_map_layer();
+        }
+        if( fartilecontext ) {
+            fartilecontext->invalidate_map_layer();
+        }
         needupdate = true;
         restore_on_out_of_scope<input_event> prev_last_input( last_input );
         // FIXME: SDL_RENDER_TARGETS_RESET only seems to be fired after the first redraw
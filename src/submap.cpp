@@ -4,9 +4,11 @@
 #include <array>
 #include <iterator>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 
 #include "basecamp.h"
+#include "hash_utils.h"
 #include "mapdata.h"
 #include "tileray.h"
 #include "trap.h"
@@ -19,15 +21,105 @@ static const furn_str_id furn_f_console( "f_console" );
 
 static const trap_str_id tr_ledge( "tr_ledge" );
 
+uint64_t next_submap_version()
+{
+    static uint64_t last_version = 0;
+    return ++last_version;
+}
+
+size_t maptile_layers::hash() const
+{
+    size_t ret = 0;
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            cata::hash_combine( ret, ter[x][y].to_i() );
+            cata::hash_combine( ret, frn[x][y].to_i() );
+            cata::hash_combine( ret, trp[x][y].to_i() );
+            cata::hash_combine( ret, lum[x][y] );
+            cata::hash_combine( ret, rad[x][y] );
+        }
+    }
+    return ret;
+}
+
+bool maptile_layers::operator==( const maptile_layers &rhs ) const
+{
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            if( ter[x][y] != rhs.ter[x][y] || frn[x][y] != rhs.frn[x][y] ||
+                trp[x][y] != rhs.trp[x][y] || lum[x][y] != rhs.lum[x][y] ||
+                rad[x][y] != rhs.rad[x][y] ) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Every distinct set of layers currently in use, by hash.  Entries of layers no
+// longer used by any submap are dropped when their bucket is visited, or by
+// maptile_soa::drop_unused_shared_layers() once submaps are unloaded.
+static std::unordered_multimap<size_t, std::weak_ptr<maptile_layers>> &shared_layers()
+{
+    static std::unordered_multimap<size_t, std::weak_ptr<maptile_layers>> shared;
+    return shared;
+}
+
+void maptile_soa::drop_unused_shared_layers()
+{
+    auto &shared = shared_layers();
+    for( auto it = shared.begin(); it != shared.end(); ) {
+        if( it->second.expired() ) {
+            it = shared.erase( it );
+        } else {
+            ++it;
+        }
+    }
+}
+
+void maptile_soa::clear_shared_layers()
+{
+    shared_layers().clear();
+}
+
+size_t maptile_soa::shared_layers_count()
+{
+    return shared_layers().size();
+}
+
+void maptile_soa::share_layers()
+{
+    auto &shared = shared_layers();
+    const size_t hash = layers_->hash();
+    const auto range = shared.equal_range( hash );
+    for( auto it = range.first; it != range.second; ) {
+        std::shared_ptr<maptile_layers> other = it->second.lock();
+        if( !other ) {
+            it = shared.erase( it );
+            continue;
+        }
+        if( other == layers_ ) {
+            return;
+        }
+        if( *other == *layers_ ) {
+            layers_ = std::move( other );
+            return;
+        }
+        ++it;
+    }
+    shared.emplace( hash, layers_ );
+}
+
 void maptile_soa::swap_soa_tile( const point_sm_ms &p1, const point_sm_ms &p2 )
 {
-    std::swap( ter[p1.x()][p1.y()], ter[p2.x()][p2.y()] );
-    std::swap( frn[p1.x()][p1.y()], frn[p2.x()][p2.y()] );
-    std::swap( lum[p1.x()][p1.y()], lum[p2.x()][p2.y()] );
+    maptile_layers &layers = mutable_layers();
+    std::swap( layers.ter[p1.x()][p1.y()], layers.ter[p2.x()][p2.y()] );
+    std::swap( layers.frn[p1.x()][p1.y()], layers.frn[p2.x()][p2.y()] );
+    std::swap( layers.lum[p1.x()][p1.y()], layers.lum[p2.x()][p2.y()] );
     std::swap( itm[p1.x()][p1.y()], itm[p2.x()][p2.y()] );
     std::swap( fld[p1.x()][p1.y()], fld[p2.x()][p2.y()] );
-    std::swap( trp[p1.x()][p1.y()], trp[p2.x()][p2.y()] );
-    std::swap( rad[p1.x()][p1.y()], rad[p2.x()][p2.y()] );
+    std::swap( layers.trp[p1.x()][p1.y()], layers.trp[p2.x()][p2.y()] );
+    std::swap( layers.rad[p1.x()][p1.y()], layers.rad[p2.x()][p2.y()] );
 }
 
 submap::submap( submap && ) noexcept( map_is_noexcept ) = default;
@@ -106,7 +198,7 @@ void submap::delete_graffiti( const point_sm_ms &p )
 }
 bool submap::has_signage( const point_sm_ms &p ) const
 {
-    if( !is_uniform() && m->frn[p.x()][p.y()].obj().has_flag( ter_furn_flag::TFLAG_SIGN ) ) {
+    if( !is_uniform() && m->layers().frn[p.x()][p.y()].obj().has_flag( ter_furn_flag::TFLAG_SIGN ) ) {
         return find_cosmetic( cosmetics, p, COSMETICS_SIGNAGE ).result;
     }
 
@@ -114,7 +206,7 @@ bool submap::has_signage( const point_sm_ms &p ) const
 }
 std::string submap::get_signage( const point_sm_ms &p ) const
 {
-    if( !is_uniform() && m->frn[p.x()][p.y()].obj().has_flag( ter_furn_flag::TFLAG_SIGN ) ) {
+    if( !is_uniform() && m->layers().frn[p.x()][p.y()].obj().has_flag( ter_furn_flag::TFLAG_SIGN ) ) {
         const cosmetic_find_result fresult = find_cosmetic( cosmetics, p, COSMETICS_SIGNAGE );
         if( fresult.result ) {
             return cosmetics[ fresult.ndx ].str;
@@ -324,6 +416,7 @@ void submap::mirror( bool horizontally )
 void submap::revert_submap( submap &sr )
 {
     reverted = true;
+    mark_modified();
     if( sr.is_uniform() ) {
         m.reset();
         set_all_ter( sr.get_ter( point_sm_ms_zero ), true );
@@ -334,9 +427,10 @@ void submap::revert_submap( submap &sr )
     for( int x = 0; x < SEEX; x++ ) {
         for( int y = 0; y < SEEY; y++ ) {
             point_sm_ms pt( x, y );
-            m->frn[x][y] = sr.get_furn( pt );
-            m->ter[x][y] = sr.get_ter( pt );
-            m->trp[x][y] = sr.get_trap( pt );
+            maptile_layers &layers = m->mutable_layers();
+            layers.frn[x][y] = sr.get_furn( pt );
+            layers.ter[x][y] = sr.get_ter( pt );
+            layers.trp[x][y] = sr.get_trap( pt );
             m->itm[x][y] = sr.get_items( pt );
             for( item &itm : m->itm[x][y] ) {
                 if( itm.is_emissive() ) {
@@ -364,8 +458,8 @@ void submap::update_lum_rem( const point_sm_ms &p, const item &i )
     ensure_nonuniform();
     if( !i.is_emissive() ) {
         return;
-    } else if( m->lum[p.x()][p.y()] && m->lum[p.x()][p.y()] < 255 ) {
-        m->lum[p.x()][p.y()]--;
+    } else if( m->layers().lum[p.x()][p.y()] && m->layers().lum[p.x()][p.y()] < 255 ) {
+        m->mutable_layers().lum[p.x()][p.y()]--;
         return;
     }
 
@@ -379,28 +473,30 @@ void submap::update_lum_rem( const point_sm_ms &p, const item &i )
     }
 
     if( count <= 256 ) {
-        m->lum[p.x()][p.y()] = static_cast<uint8_t>( count - 1 );
+        m->mutable_layers().lum[p.x()][p.y()] = static_cast<uint8_t>( count - 1 );
     }
 }
 
 void submap::merge_submaps( submap *copy_from, bool copy_from_is_overlay )
 {
     this->field_count = 0;
+    const maptile_layers &from = copy_from->m->layers();
+    maptile_layers &to = this->m->mutable_layers();
 
     for( int x = 0; x < SEEX; x++ ) {
         for( int y = 0; y < SEEY; y++ ) {
-            if( copy_from->m->ter[x][y] != t_null && ( copy_from_is_overlay ||
-                    this->m->ter[x][y] == t_null ) ) {
-                this->m->ter[x][y] = copy_from->m->ter[x][y];
+            if( from.ter[x][y] != t_null && ( copy_from_is_overlay ||
+                    to.ter[x][y] == t_null ) ) {
+                to.ter[x][y] = from.ter[x][y];
                 this->set_map_damage( { x, y }, copy_from->get_map_damage( { x, y } ) );
             }
 
-            if( copy_from->m->frn[x][y] != f_null && ( copy_from_is_overlay ||
-                    this->m->frn[x][y] == f_null ) ) {
-                this->m->frn[x][y] = copy_from->m->frn[x][y];
+            if( from.frn[x][y] != f_null && ( copy_from_is_overlay ||
+                    to.frn[x][y] == f_null ) ) {
+                to.frn[x][y] = from.frn[x][y];
             }
 
-            this->m->lum[x][y] += copy_from->m->lum[x][y];
+            to.lum[x][y] += from.lum[x][y];
 
             for( const item &itm : copy_from->m->itm[x][y] ) {
                 this->m->itm[x][y].emplace( itm );
@@ -423,13 +519,13 @@ void submap::merge_submaps( submap *copy_from, bool copy_from_is_overlay )
                 this->field_count++;
             }
 
-            if( copy_from->m->trp[x][y] != tr_null && ( copy_from_is_overlay ||
-                    this->m->trp[x][y] == tr_null ) ) {
-                this->m->trp[x][y] = copy_from->m->trp[x][y];
+            if( from.trp[x][y] != tr_null && ( copy_from_is_overlay ||
+                    to.trp[x][y] == tr_null ) ) {
+                to.trp[x][y] = from.trp[x][y];
             }
 
-            if( copy_from->m->rad[x][y] > 0 && ( copy_from_is_overlay || this->m->rad[x][y] == 0 ) ) {
-                this->m->rad[x][y] = copy_from->m->rad[x][y];
+            if( from.rad[x][y] > 0 && ( copy_from_is_overlay || to.rad[x][y] == 0 ) ) {
+                to.rad[x][y] = from.rad[x][y];
             }
         }
     }
@@ -480,7 +576,7 @@ void submap::merge_submaps( submap *copy_from, bool copy_from_is_overlay )
     }
 
     for( const std::pair<const point_sm_ms, computer>  &comp : copy_from->computers ) {
-        if( this->m->frn[comp.first.x()][comp.first.y()] == furn_f_console &&
+        if( to.frn[comp.first.x()][comp.first.y()] == furn_f_console &&
             !this->get_computer( comp.first ) ) {
             this->set_computer( comp.first, comp.second );
         }
@@ -54,18 +54,64 @@ struct spawn_point {
         mission_id( MIS ), friendly( F ), name( N ), data( SD ) {}
 };
 
-// Suppression due to bug in clang-tidy 12
-// NOLINTNEXTLINE(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
-struct maptile_soa {
+/**
+ * The plain per-square values of a submap. Submaps whose layers are identical
+ * share a single copy (see @ref maptile_soa::share_layers) until one of them
+ * is modified.
+ */
+struct maptile_layers {
     cata::mdarray<ter_id, point_sm_ms>             ter; // Terrain on each square
     cata::mdarray<furn_id, point_sm_ms>            frn; // Furniture on each square
     cata::mdarray<std::uint8_t, point_sm_ms>       lum; // Num items emitting light on each square
-    cata::mdarray<cata::colony<item>, point_sm_ms> itm; // Items on each square
-    cata::mdarray<field, point_sm_ms>              fld; // Field on each square
     cata::mdarray<trap_id, point_sm_ms>            trp; // Trap on each square
     cata::mdarray<int, point_sm_ms>                rad; // Irradiation of each square
 
+    size_t hash() const;
+    bool operator==( const maptile_layers &rhs ) const;
+};
+
+// Hands out versions of submap contents; every value is returned only once
+uint64_t next_submap_version();
+
+// Suppression due to bug in clang-tidy 12
+// NOLINTNEXTLINE(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+struct maptile_soa {
+    cata::mdarray<cata::colony<item>, point_sm_ms> itm; // Items on each square
+    cata::mdarray<field, point_sm_ms>              fld; // Field on each square
+
+    const maptile_layers &layers() const {
+        return *layers_;
+    }
+    // Copies the layers first if they are shared with another submap
+    maptile_layers &mutable_layers() {
+        if( layers_.use_count() > 1 ) {
+            // Not from make_shared, see layers_
+            // NOLINTNEXTLINE(modernize-make-shared)
+            layers_ = std::shared_ptr<maptile_layers>( new maptile_layers( *layers_ ) );
+        }
+        version = next_submap_version();
+        return *layers_;
+    }
+    // Changes whenever the layers may have been written to
+    uint64_t get_version() const {
+        return version;
+    }
+    // Replace the layers by an identical instance already used by another submap, if any
+    void share_layers();
+    // Forget layers that are no longer used by any submap, or all of them
+    static void drop_unused_shared_layers();
+    static void clear_shared_layers();
+    // Number of distinct layers known to share_layers()
+    static size_t shared_layers_count();
+
     void swap_soa_tile( const point_sm_ms &p1, const point_sm_ms &p2 );
+
+    private:
+        // Not from make_shared: share_layers() keeps weak pointers to the layers, and those
+        // would keep the memory of a combined allocation alive after the last owner is gone.
+        std::shared_ptr<maptile_layers> layers_ =
+            std::shared_ptr<maptile_layers>( new maptile_layers() ); // NOLINT(modernize-make-shared)
+        uint64_t version = next_submap_version();
 };
 
 class submap
@@ -80,11 +126,12 @@ class submap
         void ensure_nonuniform() {
             if( is_uniform() ) {
                 m = std::make_unique<maptile_soa>();
-                std::uninitialized_fill_n( &m->ter[0][0], elements, uniform_ter );
-                std::uninitialized_fill_n( &m->frn[0][0], elements, furn_str_id::NULL_ID() );
-                std::uninitialized_fill_n( &m->lum[0][0], elements, 0 );
-                std::uninitialized_fill_n( &m->trp[0][0], elements, tr_null );
-                std::uninitialized_fill_n( &m->rad[0][0], elements, 0 );
+                maptile_layers &layers = m->mutable_layers();
+                std::uninitialized_fill_n( &layers.ter[0][0], elements, uniform_ter );
+                std::uninitialized_fill_n( &layers.frn[0][0], elements, furn_str_id::NULL_ID() );
+                std::uninitialized_fill_n( &layers.lum[0][0], elements, 0 );
+                std::uninitialized_fill_n( &layers.trp[0][0], elements, tr_null );
+                std::uninitialized_fill_n( &layers.rad[0][0], elements, 0 );
             }
         }
 
@@ -96,34 +143,34 @@ class submap
             if( is_uniform() ) {
                 return tr_null;
             }
-            return m->trp[p.x()][p.y()];
+            return m->layers().trp[p.x()][p.y()];
         }
 
         void set_trap( const point_sm_ms &p, trap_id trap ) {
             ensure_nonuniform();
-            m->trp[p.x()][p.y()] = trap;
+            m->mutable_layers().trp[p.x()][p.y()] = trap;
         }
 
         void set_all_traps( const trap_id &trap ) {
             ensure_nonuniform();
-            std::uninitialized_fill_n( &m->trp[0][0], elements, trap );
+            std::uninitialized_fill_n( &m->mutable_layers().trp[0][0], elements, trap );
         }
 
         furn_id get_furn( const point_sm_ms &p ) const {
             if( is_uniform() ) {
                 return furn_str_id::NULL_ID();
             }
-            return m->frn[p.x()][p.y()];
+            return m->layers().frn[p.x()][p.y()];
         }
 
         void set_furn( const point_sm_ms &p, furn_id furn ) {
             ensure_nonuniform();
-            m->frn[p.x()][p.y()] = furn;
+            m->mutable_layers().frn[p.x()][p.y()] = furn;
         }
 
         void set_all_furn( const furn_id &furn ) {
             ensure_nonuniform();
-            std::uninitialized_fill_n( &m->frn[0][0], elements, furn );
+            std::uninitialized_fill_n( &m->mutable_layers().frn[0][0], elements, furn );
         }
         int get_map_damage( const point_sm_ms &p ) const {
             auto it = ephemeral_data.find( p );
@@ -141,12 +188,12 @@ class submap
             if( is_uniform() ) {
                 return uniform_ter;
             }
-            return m->ter[p.x()][p.y()];
+            return m->layers().ter[p.x()][p.y()];
         }
 
         void set_ter( const point_sm_ms &p, ter_id terr ) {
             ensure_nonuniform();
-            m->ter[p.x()][p.y()] = terr;
+            m->mutable_layers().ter[p.x()][p.y()] = terr;
         }
 
         void set_all_ter( const ter_id &terr, bool uniform_ok = false ) {
@@ -155,8 +202,9 @@ class submap
             }
             if( is_uniform() ) {
                 uniform_ter = terr;
+                uniform_version = next_submap_version();
             } else {
-                std::uninitialized_fill_n( &m->ter[0][0], elements, terr );
+                std::uninitialized_fill_n( &m->mutable_layers().ter[0][0], elements, terr );
             }
         }
 
@@ -164,30 +212,30 @@ class submap
             if( is_uniform() ) {
                 return 0;
             }
-            return m->rad[p.x()][p.y()];
+            return m->layers().rad[p.x()][p.y()];
         }
 
         void set_radiation( const point_sm_ms &p, const int radiation ) {
             ensure_nonuniform();
-            m->rad[p.x()][p.y()] = radiation;
+            m->mutable_layers().rad[p.x()][p.y()] = radiation;
         }
 
         uint8_t get_lum( const point_sm_ms &p ) const {
             if( is_uniform() ) {
                 return 0;
             }
-            return m->lum[p.x()][p.y()];
+            return m->layers().lum[p.x()][p.y()];
         }
 
         void set_lum( const point_sm_ms &p, uint8_t luminance ) {
             ensure_nonuniform();
-            m->lum[p.x()][p.y()] = luminance;
+            m->mutable_layers().lum[p.x()][p.y()] = luminance;
         }
 
         void update_lum_add( const point_sm_ms &p, const item &i ) {
             ensure_nonuniform();
-            if( i.is_emissive() && m->lum[p.x()][p.y()] < 255 ) {
-                m->lum[p.x()][p.y()]++;
+            if( i.is_emissive() && m->layers().lum[p.x()][p.y()] < 255 ) {
+                m->mutable_layers().lum[p.x()][p.y()]++;
             }
         }
 
@@ -300,6 +348,32 @@ class submap
         // Z levels.
         void merge_submaps( submap *copy_from, bool copy_from_is_overlay );
 
+        // Changes whenever terrain, furniture, traps, luminance or radiation may have
+        // changed. Versions are never reused, so an unchanged version means unchanged layers.
+        uint64_t layers_version() const {
+            return is_uniform() ? uniform_version : m->get_version();
+        }
+
+        // Records that the submap may differ from its saved copy
+        void mark_modified() {
+            modified_version = next_submap_version();
+        }
+        // Records that the submap is identical to its saved copy
+        void mark_saved() {
+            modified_version = 0;
+        }
+        // Whether the submap may have changed after version @p saved was handed out
+        bool modified_since( uint64_t saved ) const {
+            return modified_version > saved;
+        }
+
+        // Share the per-square layers with other submaps having identical ones
+        void share_layers() {
+            if( !is_uniform() ) {
+                m->share_layers();
+            }
+        }
+
         std::vector<cosmetic_t> cosmetics; // Textual "visuals" for squares
 
         active_item_cache active_items;
@@ -326,6 +400,8 @@ class submap
         std::map<point_sm_ms, computer> computers;
         std::unique_ptr<maptile_soa> m;
         ter_id uniform_ter = t_null;
+        uint64_t uniform_version = next_submap_version(); // NOLINT(cata-serialize)
+        uint64_t modified_version = next_submap_version(); // NOLINT(cata-serialize)
         int temperature_mod = 0; // delta in F
 
         static constexpr size_t elements = SEEX * SEEY;
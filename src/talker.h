@@ -2,10 +2,12 @@
 #ifndef CATA_SRC_TALKER_H
 #define CATA_SRC_TALKER_H
 
+#include "cata_utility.h"
 #include "coords_fwd.h"
 #include "effect.h"
 #include "item.h"
 #include "messages.h"
+#include "string_formatter.h"
 #include "type_id.h"
 #include "units.h"
 #include "units_fwd.h"
@@ -360,6 +362,15 @@ class talker
         }
         virtual void set_value( const std::string &, const std::string & ) {}
         virtual void remove_value( const std::string & ) {}
+        // numeric shortcuts for talkers with typed storage; the defaults go through the strings
+        virtual std::optional<double> maybe_get_num_value( const std::string &key ) const {
+            std::optional<std::string> const val = maybe_get_value( key );
+            return val ? svtod( *val ) : std::nullopt;
+        }
+        virtual void set_num_value( const std::string &key, double value ) {
+            // NOLINTNEXTLINE(cata-translate-string-literal)
+            set_value( key, string_format( "%g", value ) );
+        }
 
         // inventory, buying, and selling
         virtual bool is_wearing( const itype_id & ) const {
@@ -114,6 +114,7 @@ class talker_character_const: public talker_cloner<talker_character_const>
         bool is_deaf() const override;
         bool is_mute() const override;
         std::optional<std::string> maybe_get_value( const std::string &var_name ) const override;
+        std::optional<double> maybe_get_num_value( const std::string &var_name ) const override;
 
         // stats, skills, traits, bionics, magic, and proficiencies
         std::vector<skill_id> skills_teacheable() const override;
@@ -258,6 +259,7 @@ class talker_character: public talker_cloner<talker_character, talker_character_
                        ) override;
         void remove_effect( const efftype_id &old_effect, const std::string &bp ) override;
         void set_value( const std::string &var_name, const std::string &value ) override;
+        void set_num_value( const std::string &var_name, double value ) override;
         void remove_value( const std::string &var_name ) override;
 
         // inventory, buying, and selling
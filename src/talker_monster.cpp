@@ -107,6 +107,11 @@ const
     return me_mon_const->maybe_get_value( var_name );
 }
 
+std::optional<double> talker_monster_const::maybe_get_num_value( const std::string &var_name ) const
+{
+    return me_mon_const->maybe_get_num_value( var_name );
+}
+
 bool talker_monster_const::has_flag( const flag_id &f ) const
 {
     add_msg_debug( debugmode::DF_TALKER, "Monster %s checked for flag %s", me_mon_const->name(),
@@ -133,6 +138,11 @@ void talker_monster::set_value( const std::string &var_name, const std::string &
     me_mon->set_value( var_name, value );
 }
 
+void talker_monster::set_num_value( const std::string &var_name, double value )
+{
+    me_mon->set_value( var_name, value );
+}
+
 void talker_monster::remove_value( const std::string &var_name )
 {
     me_mon->remove_value( var_name );
@@ -50,6 +50,7 @@ class talker_monster_const: public talker_cloner<talker_monster_const>
         effect get_effect( const efftype_id &effect_id, const bodypart_id &bp ) const override;
 
         std::optional<std::string> maybe_get_value( const std::string &var_name ) const override;
+        std::optional<double> maybe_get_num_value( const std::string &var_name ) const override;
 
         bool has_flag( const flag_id &f ) const override;
         bool has_species( const species_id &species ) const override;
@@ -103,6 +104,7 @@ class talker_monster: public talker_cloner<talker_monster, talker_monster_const>
         void mod_pain( int amount ) override;
 
         void set_value( const std::string &var_name, const std::string &value ) override;
+        void set_num_value( const std::string &var_name, double value ) override;
         void remove_value( const std::string &var_name ) override;
 
         void set_anger( int ) override;
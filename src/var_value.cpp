@@ -0,0 +1,55 @@
+#include "var_value.h"
+
+#include "cata_utility.h"
+#include "json.h"
+#include "string_formatter.h"
+
+const std::string &var_value::get_str() const
+{
+    if( form == state::number ) {
+        // NOLINTNEXTLINE(cata-translate-string-literal)
+        str = string_format( "%g", num );
+        form = state::formatted;
+    }
+    return str;
+}
+
+std::optional<double> var_value::get_num() const
+{
+    if( form == state::string ) {
+        std::optional<double> const parsed = svtod( str );
+        form = parsed ? state::parsed : state::not_number;
+        num = parsed.value_or( 0 );
+    }
+    if( form == state::not_number ) {
+        return std::nullopt;
+    }
+    return num;
+}
+
+// The shortest of the usual precisions that reads back as the same number
+static std::string round_trip_string( double val )
+{
+    // NOLINTNEXTLINE(cata-translate-string-literal)
+    std::string shorter = string_format( "%.15g", val );
+    if( svtod( shorter ) == val ) {
+        return shorter;
+    }
+    // NOLINTNEXTLINE(cata-translate-string-literal)
+    return string_format( "%.17g", val );
+}
+
+void var_value::serialize( JsonOut &jsout ) const
+{
+    // get_str() rounds numbers, which would change them across a save and load
+    if( form == state::number || form == state::formatted ) {
+        jsout.write( round_trip_string( num ) );
+    } else {
+        jsout.write( str );
+    }
+}
+
+void var_value::deserialize( const JsonValue &jsin )
+{
+    *this = var_value( jsin.get_string() );
+}
@@ -0,0 +1,49 @@
+#pragma once
+#ifndef CATA_SRC_VAR_VALUE_H
+#define CATA_SRC_VAR_VALUE_H
+
+#include <optional>
+#include <string>
+#include <utility>
+
+class JsonOut;
+class JsonValue;
+
+/**
+ * Value of a dialogue/EOC variable.
+ *
+ * Variables used to be stored purely as strings, so every numeric read reparsed the string and
+ * every numeric write formatted one.  This keeps whichever form was written last and derives the
+ * other one on first request, so math expressions that read and write numbers never round-trip
+ * through text.  Saves always contain a string, which keeps them compatible in both directions;
+ * numbers are written with enough digits to load back unchanged.
+ */
+class var_value
+{
+    public:
+        var_value() = default;
+        explicit var_value( std::string val ) : str( std::move( val ) ) {}
+        explicit var_value( double val ) : num( val ), form( state::number ) {}
+
+        /// String form.  Numbers are formatted the same way write_var_value always did.
+        const std::string &get_str() const;
+        /// Numeric form, or nullopt if the value is not a number.
+        std::optional<double> get_num() const;
+
+        void serialize( JsonOut &jsout ) const;
+        void deserialize( const JsonValue &jsin );
+
+    private:
+        enum class state : int {
+            string = 0,  // only str is valid, not parsed yet
+            number,      // only num is valid
+            parsed,      // str and num are both valid, num was parsed from str
+            formatted,   // str and num are both valid, str was formatted from num
+            not_number,  // str is valid and does not parse as a number
+        };
+        mutable std::string str; // NOLINT(cata-serialize): written through get_str()
+        mutable double num = 0; // NOLINT(cata-serialize)
+        mutable state form = state::string; // NOLINT(cata-serialize)
+};
+
+#endif // CATA_SRC_VAR_VALUE_H
@@ -2584,6 +2584,21 @@ std::vector<int> vehicle::parts_at_relative( const point &dp, const bool use_cac
                 }
             }
         }
+    } else if( !relative_parts_grid.empty() ) {
+        const point cell = dp - relative_parts_grid_min;
+        if( cell.x < 0 || cell.y < 0 || cell.x >= relative_parts_grid_size.x ||
+            cell.y >= relative_parts_grid_size.y ) {
+            return res;
+        }
+        const std::pair<int, int> &range =
+            relative_parts_grid[cell.y * relative_parts_grid_size.x + cell.x];
+        res.reserve( range.second - range.first );
+        for( int i = range.first; i < range.second; i++ ) {
+            const int vp = relative_parts_index[i];
+            if( include_fake || !parts[vp].is_fake ) {
+                res.push_back( vp );
+            }
+        }
     } else {
         const auto &iter = relative_parts.find( dp );
         if( iter != relative_parts.end() ) {
@@ -3350,6 +3365,10 @@ void vehicle::precalc_mounts( int idir, const units::angle &dir,
     if( idir < 0 || idir > 1 ) {
         idir = 0;
     }
+    if( idir == 0 ) {
+        // parts are moving, cables may now lead somewhere else
+        invalidate_power_grid();
+    }
     tileray tdir( dir );
     std::unordered_map<point, tripoint> mount_to_precalc;
     for( vehicle_part &p : parts ) {
@@ -3543,7 +3562,7 @@ int64_t vehicle::fuel_left( const itype_id &ftype,
 {
     int64_t fl = 0;
     if( ftype == fuel_type_battery ) {
-        for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles() ) {
+        for( const std::pair<vehicle *const, float> &pair : search_connected_vehicles() ) {
             const vehicle &veh = *pair.first;
             const float loss = pair.second;
             for( const int part_idx : veh.batteries ) {
@@ -3607,7 +3626,7 @@ int vehicle::fuel_capacity( const itype_id &ftype ) const
 {
     if( ftype == fuel_type_battery ) { // batteries get special treatment due to power cables
         int64_t capacity = 0;
-        for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles() ) {
+        for( const std::pair<vehicle *const, float> &pair : search_connected_vehicles() ) {
             const vehicle &veh = *pair.first;
             for( const int part_idx : veh.batteries ) {
                 const vehicle_part &vp = veh.parts[part_idx];
@@ -5053,7 +5072,7 @@ std::pair<int, int> vehicle::connected_battery_power_level() const
     int total_epower_remaining = 0;
     int total_epower_capacity = 0;
 
-    for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles() ) {
+    for( const std::pair<vehicle *const, float> &pair : search_connected_vehicles() ) {
         int epower_remaining;
         int epower_capacity;
         std::tie( epower_remaining, epower_capacity ) = pair.first->battery_power_level();
@@ -5425,11 +5444,30 @@ vehicle *vehicle::find_vehicle_using_parts( const tripoint_abs_ms &where )
     return nullptr;
 }
 
-template<typename Vehicle> // Templated to support const and non-const vehicle*
-std::map<Vehicle *, float> vehicle::search_connected_vehicles( Vehicle *start )
+void vehicle::invalidate_power_grid()
+{
+    ++*grid_cache.version;
+}
+
+bool vehicle::power_grid_cache::is_valid() const
+{
+    if( !valid ) {
+        return false;
+    }
+    for( const std::pair<std::weak_ptr<const uint64_t>, uint64_t> &seen : versions ) {
+        const std::shared_ptr<const uint64_t> current = seen.first.lock();
+        // a vehicle of the grid is gone or has changed
+        if( !current || *current != seen.second ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::map<vehicle *, float> vehicle::search_connected_vehicles( vehicle *start, bool *complete )
 {
-    std::map<Vehicle *, float> distances; // distance represents sum of cable losses
-    std::vector<Vehicle *> queue;
+    std::map<vehicle *, float> distances; // distance represents sum of cable losses
+    std::vector<vehicle *> queue;
 
     distances[start] = 0;
     queue.emplace_back( start );
@@ -5439,7 +5477,7 @@ std::map<Vehicle *, float> vehicle::search_connected_vehicles( Vehicle *start )
     // Tree will span from self(root) to other connected vehicles
     // where distance metric is power transfer loss ( resistance to heat inefficiency )
     while( !queue.empty() ) {
-        Vehicle *const veh = queue.back();
+        vehicle *const veh = queue.back();
         queue.pop_back();
 
         for( const int part_idx : veh->loose_parts ) { // graph "edges" are POWER_TRANSFER parts
@@ -5449,8 +5487,11 @@ std::map<Vehicle *, float> vehicle::search_connected_vehicles( Vehicle *start )
                 continue;
             }
 
-            Vehicle *const v_next = find_vehicle_using_parts( tripoint_abs_ms( vp.target.second ) );
+            vehicle *const v_next = find_vehicle_using_parts( tripoint_abs_ms( vp.target.second ) );
             if( v_next == nullptr ) { // vehicle's rolled away or off-map
+                if( complete != nullptr ) {
+                    *complete = false;
+                }
                 continue;
             }
             // try insert infinity for initial unvisited node distance
@@ -5467,14 +5508,53 @@ std::map<Vehicle *, float> vehicle::search_connected_vehicles( Vehicle *start )
     return distances;
 }
 
-std::map<vehicle *, float> vehicle::search_connected_vehicles()
+// helper method to calculate power loss weighted by capacity
+static double weighted_power_loss( const std::map<vpart_reference, float> &batteries )
 {
-    return search_connected_vehicles( this );
+    double res = 0.0; // sum of power losses
+    int64_t total_capacity = 0; // sum of capacity of all batteries
+    for( const std::pair<const vpart_reference, float> &pair : batteries ) {
+        vehicle_part &vp = pair.first.part();
+        const int capacity = vp.ammo_capacity( ammo_battery );
+        total_capacity += capacity;
+        res += pair.second * capacity;
+    }
+    return res / total_capacity;
+}
+
+const std::map<vehicle *, float> &vehicle::search_connected_vehicles()
+{
+    if( !grid_cache.is_valid() ) {
+        // a vehicle may show up where a cable leads nowhere yet without any vehicle of the
+        // grid changing, so those grids are searched again every time
+        bool complete = true;
+        grid_cache.vehicles = search_connected_vehicles( this, &complete );
+        grid_cache.batteries.clear();
+        grid_cache.versions.clear();
+        for( const std::pair<vehicle *const, float> &connected : grid_cache.vehicles ) {
+            vehicle *veh = connected.first;
+            // the battery list of a vehicle only changes on refresh, which bumps its version
+            for( const int part_idx : veh->batteries ) {
+                const vpart_reference vpr( *veh, part_idx );
+                if( vpr.part().is_fake ) {
+                    continue;
+                }
+                grid_cache.batteries.emplace( vpr, connected.second );
+            }
+            const std::shared_ptr<uint64_t> &version = veh->grid_cache.version;
+            grid_cache.versions.emplace_back( version, *version );
+        }
+        grid_cache.battery_loss = grid_cache.batteries.empty() ? 0.0 :
+                                  weighted_power_loss( grid_cache.batteries );
+        grid_cache.valid = complete;
+    }
+    return grid_cache.vehicles;
 }
 
-std::map<const vehicle *, float> vehicle::search_connected_vehicles() const
+const std::map<vehicle *, float> &vehicle::search_connected_vehicles() const
 {
-    return search_connected_vehicles( this );
+    // the search itself doesn't modify anything, it only needs mutable pointers for the cache
+    return const_cast<vehicle *>( this )->search_connected_vehicles();
 }
 
 void vehicle::get_connected_vehicles( std::unordered_set<vehicle *> &dest )
@@ -5496,37 +5576,10 @@ void vehicle::get_connected_vehicles( std::unordered_set<vehicle *> &dest )
     }
 }
 
-std::map<vpart_reference, float> vehicle::search_connected_batteries()
+const std::map<vpart_reference, float> &vehicle::search_connected_batteries()
 {
-    std::map<vpart_reference, float> result;
-
-    for( const std::pair<vehicle *const, float> &pair : search_connected_vehicles() ) {
-        vehicle *veh = pair.first;
-        const float efficiency = pair.second;
-        for( const int part_idx : veh->batteries ) {
-            const vpart_reference vpr( *veh, part_idx );
-            if( vpr.part().is_fake ) {
-                continue;
-            }
-            result.emplace( vpr, efficiency );
-        }
-    }
-
-    return result;
-}
-
-// helper method to calculate power loss weighted by capacity
-static double weighted_power_loss( const std::map<vpart_reference, float> &batteries )
-{
-    double res = 0.0; // sum of power losses
-    int64_t total_capacity = 0; // sum of capacity of all batteries
-    for( const std::pair<const vpart_reference, float> &pair : batteries ) {
-        vehicle_part &vp = pair.first.part();
-        const int capacity = vp.ammo_capacity( ammo_battery );
-        total_capacity += capacity;
-        res += pair.second * capacity;
-    }
-    return res / total_capacity;
+    search_connected_vehicles();
+    return grid_cache.batteries;
 }
 
 // helper method to take a map of batteries, amount of charge, total capacity of batteries
@@ -5564,7 +5617,7 @@ static void distribute_charge_evenly( const std::map<vpart_reference, float> &ba
 int64_t vehicle::battery_left( bool apply_loss ) const
 {
     int64_t ret = 0;
-    for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles() ) {
+    for( const std::pair<vehicle *const, float> &pair : search_connected_vehicles() ) {
         const vehicle &veh = *pair.first;
         const float efficiency = 1.0f - ( apply_loss ? pair.second : 0.0f );
         for( const int part_idx : veh.batteries ) {
@@ -5584,11 +5637,11 @@ int vehicle::charge_battery( int amount, bool apply_loss )
     if( amount == 0 ) {
         return 0;
     }
-    const std::map<vpart_reference, float> batteries = search_connected_batteries();
+    const std::map<vpart_reference, float> &batteries = search_connected_batteries();
     if( batteries.empty() ) {
         return amount;
     }
-    const double loss = apply_loss ? weighted_power_loss( batteries ) : 0.0;
+    const double loss = apply_loss ? grid_cache.battery_loss : 0.0;
     int64_t total_charge = 0; // sum of current charge of all batteries
     int64_t total_capacity = 0; // sum of capacity of all batteries
     for( const std::pair<const vpart_reference, float> &pair : batteries ) {
@@ -5627,11 +5680,11 @@ int vehicle::discharge_battery( int amount, bool apply_loss )
     if( amount == 0 ) {
         return 0;
     }
-    const std::map<vpart_reference, float> batteries = search_connected_batteries();
+    const std::map<vpart_reference, float> &batteries = search_connected_batteries();
     if( batteries.empty() ) {
         return amount;
     }
-    const double loss = apply_loss ? weighted_power_loss( batteries ) : 0.0;
+    const double loss = apply_loss ? grid_cache.battery_loss : 0.0;
     int64_t total_charge = 0; // sum of current charge of all batteries
     int64_t total_capacity = 0; // sum of capacity of all batteries
     for( const std::pair<const vpart_reference, float> &pair : batteries ) {
@@ -6239,6 +6292,8 @@ void vehicle::refresh( const bool remove_fakes )
         return;
     }
 
+    invalidate_power_grid();
+
     alternators.clear();
     engines.clear();
     reactors.clear();
@@ -6249,6 +6304,8 @@ void vehicle::refresh( const bool remove_fakes )
     funnels.clear();
     emitters.clear();
     relative_parts.clear();
+    relative_parts_grid.clear();
+    relative_parts_index.clear();
     loose_parts.clear();
     wheelcache.clear();
     rail_wheelcache.clear();
@@ -6520,6 +6577,7 @@ void vehicle::refresh( const bool remove_fakes )
         }
     }
 
+    rebuild_relative_parts_grid();
     // NB: using the _old_ pivot point, don't recalc here, we only do that when moving!
     precalc_mounts( 0, pivot_rotation[0], pivot_anchor[0] );
     // update the fakes, and then repopulate the cache
@@ -6533,6 +6591,36 @@ void vehicle::refresh( const bool remove_fakes )
     refresh_active_item_cache();
 }
 
+void vehicle::rebuild_relative_parts_grid()
+{
+    relative_parts_grid.clear();
+    relative_parts_index.clear();
+    if( relative_parts.empty() ) {
+        return;
+    }
+    // fake parts can stick out of mount_min/mount_max, so measure relative_parts itself
+    point p_min = relative_parts.begin()->first;
+    point p_max = p_min;
+    for( const std::pair<const point, std::vector<int>> &rp : relative_parts ) {
+        p_min.x = std::min( p_min.x, rp.first.x );
+        p_min.y = std::min( p_min.y, rp.first.y );
+        p_max.x = std::max( p_max.x, rp.first.x );
+        p_max.y = std::max( p_max.y, rp.first.y );
+    }
+    relative_parts_grid_min = p_min;
+    relative_parts_grid_size = p_max - p_min + point_south_east;
+    relative_parts_grid.resize( static_cast<size_t>( relative_parts_grid_size.x ) *
+                                relative_parts_grid_size.y, { 0, 0 } );
+    for( const std::pair<const point, std::vector<int>> &rp : relative_parts ) {
+        const point cell = rp.first - p_min;
+        const int begin = static_cast<int>( relative_parts_index.size() );
+        relative_parts_index.insert( relative_parts_index.end(), rp.second.begin(), rp.second.end() );
+        relative_parts_grid[cell.y * relative_parts_grid_size.x + cell.x] = {
+            begin, static_cast<int>( relative_parts_index.size() )
+        };
+    }
+}
+
 vpart_edge_info vehicle::get_edge_info( const point &mount ) const
 {
     point forward = mount + point_east;
@@ -8008,6 +8096,8 @@ void vehicle::update_time( const time_point &update_to )
         }
     }
 
+    // sum up all sources first, so the grid only has to absorb the energy once
+    int energy_bat = 0;
     if( !solar_panels.empty() ) {
         units::power epower = 0_W;
         for( const int p : solar_panels ) {
@@ -8020,30 +8110,36 @@ void vehicle::update_time( const time_point &update_to )
         }
         double intensity = accum_weather.radiant_exposure / max_sun_irradiance() / to_seconds<float>
                            ( elapsed );
-        int energy_bat = power_to_energy_bat( epower * intensity, elapsed );
-        if( energy_bat > 0 ) {
-            add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from solar panels", name, energy_bat );
-            charge_battery( energy_bat );
+        const int energy_solar = power_to_energy_bat( epower * intensity, elapsed );
+        if( energy_solar > 0 ) {
+            add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from solar panels", name,
+                           energy_solar );
+            energy_bat += energy_solar;
         }
     }
     if( !wind_turbines.empty() ) {
         // TODO: use accum_weather wind data to backfill wind turbine
         // generation capacity.
         units::power epower = total_wind_epower();
-        int energy_bat = power_to_energy_bat( epower, elapsed );
-        if( energy_bat > 0 ) {
-            add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from wind turbines", name, energy_bat );
-            charge_battery( energy_bat );
+        const int energy_wind = power_to_energy_bat( epower, elapsed );
+        if( energy_wind > 0 ) {
+            add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from wind turbines", name,
+                           energy_wind );
+            energy_bat += energy_wind;
         }
     }
     if( !water_wheels.empty() ) {
         units::power epower = total_water_wheel_epower();
-        int energy_bat = power_to_energy_bat( epower, elapsed );
-        if( energy_bat > 0 ) {
-            add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from water wheels", name, energy_bat );
-            charge_battery( energy_bat );
+        const int energy_water = power_to_energy_bat( epower, elapsed );
+        if( energy_water > 0 ) {
+            add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from water wheels", name,
+                           energy_water );
+            energy_bat += energy_water;
         }
     }
+    if( energy_bat > 0 ) {
+        charge_battery( energy_bat );
+    }
 }
 
 void vehicle::invalidate_mass()
@@ -5,10 +5,12 @@
 #include <array>
 #include <climits>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iosfwd>
 #include <list>
 #include <map>
+#include <memory>
 #include <new>
 #include <optional>
 #include <set>
@@ -858,10 +860,50 @@ class vehicle
         /// Keys are vehicles connected by POWER_TRANSFER parts, includes self
         /// Values are line loss, 0.01 corresponds to 1% charge loss to wire resistance
         /// May load the connected vehicles' submaps
-        /// Templated to support const and non-const vehicle*
-        template<typename Vehicle>
-        static std::map<Vehicle *, float> search_connected_vehicles( Vehicle *start );
+        /// Always walks the graph, use the cached member overloads instead
+        /// @param complete if given, set to false if a POWER_TRANSFER part led nowhere
+        static std::map<vehicle *, float> search_connected_vehicles( vehicle *start,
+                bool *complete = nullptr );
+
+        // Topology of the power grid as seen from this vehicle, as returned by
+        // search_connected_vehicles(), and the batteries in it. Valid while none of the
+        // vehicles in it has changed, which each of them tells through its own version.
+        // The cached distances are relative to the vehicle that computed them, so copies
+        // of a vehicle start with an invalid cache.
+        struct power_grid_cache {
+            // Bumped when this vehicle changes in a way that could change the grids it is in,
+            // gone with the vehicle
+            std::shared_ptr<uint64_t> version = std::make_shared<uint64_t>( 0 );
+            std::map<vehicle *, float> vehicles;
+            std::map<vpart_reference, float> batteries;
+            // line loss of the batteries weighted by their capacity
+            double battery_loss = 0.0;
+            // the versions of the vehicles in the grid when it was computed
+            std::vector<std::pair<std::weak_ptr<const uint64_t>, uint64_t>> versions;
+            bool valid = false;
+
+            power_grid_cache() = default;
+            power_grid_cache( const power_grid_cache & ) {}
+            power_grid_cache &operator=( const power_grid_cache & ) {
+                // the vehicle became a different one, grids it is in are no longer valid
+                ++*version;
+                vehicles.clear();
+                batteries.clear();
+                battery_loss = 0.0;
+                versions.clear();
+                valid = false;
+                return *this;
+            }
+            bool is_valid() const;
+        };
+        mutable power_grid_cache grid_cache; // NOLINT(cata-serialize)
     public:
+        /**
+         * Invalidates the cached power grid topology of the grids this vehicle is in. Needs
+         * to be called whenever a change to it could alter which vehicles POWER_TRANSFER
+         * parts lead to.
+         */
+        void invalidate_power_grid();
         /**
          * Find a possibly off-map vehicle. If necessary, loads up its submap through
          * the global MAPBUFFER and pulls it from there. For this reason, you should only
@@ -873,9 +915,9 @@ class vehicle
         // every vehicle part instead of just the vehicle's position
         static vehicle *find_vehicle_using_parts( const tripoint_abs_ms &where );
         //! @copydoc vehicle::search_connected_vehicles( Vehicle *start )
-        std::map<vehicle *, float> search_connected_vehicles();
+        const std::map<vehicle *, float> &search_connected_vehicles();
         //! @copydoc vehicle::search_connected_vehicles( Vehicle *start )
-        std::map<const vehicle *, float> search_connected_vehicles() const;
+        const std::map<vehicle *, float> &search_connected_vehicles() const;
         //! @copydoc vehicle::search_connected_vehicles( Vehicle *start )
         void get_connected_vehicles( std::unordered_set<vehicle *> &dest );
 
@@ -883,7 +925,7 @@ class vehicle
         /// Keys are batteries in vehicles (includes self) connected by POWER_TRANSFER parts
         /// Values are line loss, 0.01 corresponds to 1% charge loss to wire resistance
         /// May load the connected vehicles' submaps
-        std::map<vpart_reference, float> search_connected_batteries();
+        const std::map<vpart_reference, float> &search_connected_batteries();
 
         // constructs a vehicle, if the given \p proto_id is an empty string the vehicle is
         // constructed empty, invalid proto_id will construct empty and raise a debugmsg,
@@ -2254,6 +2296,17 @@ class vehicle
          */
         mutable point mount_max; // NOLINT(cata-serialize)
         mutable point mount_min; // NOLINT(cata-serialize)
+        /*
+         * Dense index over relative_parts covering the bounding box of all mount points
+         * (including fake parts), rebuilt at the end of refresh(). For every mount point
+         * it holds the [begin, end) range of the parts there in relative_parts_index.
+         * Empty while refresh() is still filling relative_parts.
+         */
+        std::vector<std::pair<int, int>> relative_parts_grid; // NOLINT(cata-serialize)
+        std::vector<int> relative_parts_index; // NOLINT(cata-serialize)
+        point relative_parts_grid_min; // NOLINT(cata-serialize)
+        point relative_parts_grid_size; // NOLINT(cata-serialize)
+        void rebuild_relative_parts_grid();
         mutable point mass_center_precalc; // NOLINT(cata-serialize)
         mutable point mass_center_no_precalc; // NOLINT(cata-serialize)
         tripoint autodrive_local_target = tripoint_zero; // current node the autopilot is aiming for
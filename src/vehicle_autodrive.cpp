@@ -84,7 +84,9 @@
  * edges of the graph) we consider a limited set of actions that the driver can perform at
  * each location: nothing, steer left or steer right (possibly more than once). Given a current
  * node, current speed and amount of steering we can predict where the vehicle's pivot point
- * will end up in 1 turn and connect the 2 nodes.
+ * will end up in 1 turn and connect the 2 nodes. Placements are checked against a summed-area
+ * table of the obstacles, one lookup per column of the vehicle, and the vehicle's outline for
+ * each orientation is only recomputed when its shape changes.
  *
  * In order to keep the search space small we only consider paths traveled at constant speed
  * (otherwise we'd have to add speed as an extra attribute in every node). When we need to
@@ -308,8 +310,14 @@ struct auto_navigation_data {
     int max_steer;
 
     std::array<vehicle_profile, NUM_ORIENTATIONS> profiles;
+    // shape of the vehicle the profiles were computed for: mount points of its parts and pivot
+    std::vector<point> profiles_mounts;
+    std::optional<point> profiles_pivot;
     // known obstacles on the view map
     cata::mdarray<bool, point, NAV_VIEW_SIZE_X, NAV_VIEW_SIZE_Y> is_obstacle;
+    // summed-area table of is_obstacle: obstacle_sums[x][y] is the number of obstacles
+    // in the view map rectangle from (0, 0) to (x - 1, y - 1)
+    cata::mdarray<int, point, NAV_VIEW_SIZE_X + 1, NAV_VIEW_SIZE_Y + 1> obstacle_sums;
     // z-level of where the ground is per point on the view map
     // Almost always same as the OMT's z, but might differ per mapsquare if we are driving up or down ramps
     cata::mdarray<int, point, NAV_VIEW_SIZE_X, NAV_VIEW_SIZE_Y> ground_z;
@@ -857,17 +865,57 @@ void vehicle::autodrive_controller::compute_obstacles_from_enqueued_ramp_points(
 
 void vehicle::autodrive_controller::compute_valid_positions()
 {
+    // build the summed-area table, so that a whole run of vehicle points can be checked
+    // for obstacles in constant time
+    for( int x = 0; x <= NAV_VIEW_SIZE_X; x++ ) {
+        data.obstacle_sums[x][0] = 0;
+    }
+    for( int y = 0; y <= NAV_VIEW_SIZE_Y; y++ ) {
+        data.obstacle_sums[0][y] = 0;
+    }
+    for( int x = 0; x < NAV_VIEW_SIZE_X; x++ ) {
+        for( int y = 0; y < NAV_VIEW_SIZE_Y; y++ ) {
+            data.obstacle_sums[x + 1][y + 1] = ( data.is_obstacle[x][y] ? 1 : 0 ) +
+                                               data.obstacle_sums[x][y + 1] + data.obstacle_sums[x + 1][y] -
+                                               data.obstacle_sums[x][y];
+        }
+    }
+    // number of obstacles in the rectangle between p1 and p2, both inclusive
+    const auto count_obstacles = [this]( const point & p1, const point & p2 ) {
+        return data.obstacle_sums[p2.x + 1][p2.y + 1] - data.obstacle_sums[p1.x][p2.y + 1] -
+               data.obstacle_sums[p2.x + 1][p1.y] + data.obstacle_sums[p1.x][p1.y];
+    };
+
     const coord_transformation veh_rot = {point_zero, -data.nav_to_map.rotation, point_zero};
+    std::vector<point> offsets;
+    // vertical runs of occupied points, as first and last point of the run
+    std::vector<std::pair<point, point>> runs;
     for( orientation facing : all_orientations() ) {
         const vehicle_profile &profile = data.profile( data.nav_to_map.transform( facing ) );
+        offsets.clear();
+        for( const point &veh_pt : profile.occupied_zone ) {
+            offsets.emplace_back( veh_rot.transform( veh_pt ) - veh_rot.transform( point_zero ) );
+        }
+        std::sort( offsets.begin(), offsets.end() );
+        offsets.erase( std::unique( offsets.begin(), offsets.end() ), offsets.end() );
+        runs.clear();
+        for( const point &offset : offsets ) {
+            if( !runs.empty() && runs.back().second + point_south == offset ) {
+                runs.back().second = offset;
+            } else {
+                runs.emplace_back( offset, offset );
+            }
+        }
         for( int mx = 0; mx < NAV_MAP_SIZE_X; mx++ ) {
             for( int my = 0; my < NAV_MAP_SIZE_Y; my++ ) {
                 const point nav_pt( mx, my );
+                const point view_pt = data.nav_to_view.transform( nav_pt );
                 bool valid = true;
-                for( const point &veh_pt : profile.occupied_zone ) {
-                    const point view_pt = data.nav_to_view.transform( nav_pt ) + veh_rot.transform(
-                                              veh_pt ) - veh_rot.transform( point_zero );
-                    if( !data.view_bounds.contains( view_pt ) || data.is_obstacle[view_pt.x][view_pt.y] ) {
+                for( const std::pair<point, point> &run : runs ) {
+                    const point run_start = view_pt + run.first;
+                    const point run_end = view_pt + run.second;
+                    if( !data.view_bounds.contains( run_start ) || !data.view_bounds.contains( run_end ) ||
+                        count_obstacles( run_start, run_end ) > 0 ) {
                         valid = false;
                         break;
                     }
@@ -936,8 +984,24 @@ void vehicle::autodrive_controller::precompute_data()
         // TODO: change it during simulation based on vehicle speed and terrain
         // or maybe just keep track of player moves?
         data.max_steer = 1;
-        for( orientation dir : all_orientations() ) {
-            data.profile( dir ) = compute_profile( dir );
+        // the profiles only depend on the shape of the vehicle, so keep them between OMTs
+        // unless it changed along the way
+        std::vector<point> mounts;
+        mounts.reserve( driven_veh.parts.size() );
+        for( const vehicle_part &part : driven_veh.parts ) {
+            if( !part.removed ) {
+                mounts.push_back( part.mount );
+            }
+        }
+        std::sort( mounts.begin(), mounts.end() );
+        mounts.erase( std::unique( mounts.begin(), mounts.end() ), mounts.end() );
+        const point pivot = driven_veh.pivot_point();
+        if( mounts != data.profiles_mounts || pivot != data.profiles_pivot ) {
+            for( orientation dir : all_orientations() ) {
+                data.profile( dir ) = compute_profile( dir );
+            }
+            data.profiles_mounts = std::move( mounts );
+            data.profiles_pivot = pivot;
         }
 
         // initialize navigation data
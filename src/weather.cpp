@@ -178,11 +178,10 @@ static void proc_weather_sum( const weather_type_id &wtype, weather_sum &data,
 weather_type_id current_weather( const tripoint_abs_ms &location, const time_point &t )
 {
     weather_manager &weather = get_weather();
-    const weather_generator wgen = weather.get_cur_weather_gen();
     if( weather.weather_override != WEATHER_NULL ) {
         return weather.weather_override;
     }
-    return wgen.get_weather_conditions( location, t, g->get_seed() );
+    return weather.get_cur_weather_gen().get_weather_conditions( location, t, g->get_seed() );
 }
 
 ////// Funnels.
@@ -193,6 +192,12 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
     weather_sum data;
 
     weather_manager &weather = get_weather();
+    const weather_generator &wgen = weather.get_cur_weather_gen();
+    const unsigned seed = g->get_seed();
+    // Neither depends on the time
+    const int windpower = get_local_windpower( weather.windspeed,
+                          overmap_buffer.ter( project_to<coords::omt>( location ) ),
+                          location, weather.winddirection, false );
     for( time_point t = start; t < end; t += tick_size ) {
         const time_duration diff = end - t;
         if( diff < 10_turns ) {
@@ -203,12 +208,11 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
             tick_size = 1_minutes;
         }
 
-        weather_type_id wtype = current_weather( location, t );
+        const weather_type_id wtype = weather.weather_override != WEATHER_NULL ?
+                                      weather.weather_override :
+                                      weather.timeline.conditions( wgen, seed, location, t );
         proc_weather_sum( wtype, data, t, tick_size );
-        data.wind_amount += get_local_windpower( weather.windspeed,
-                            overmap_buffer.ter( project_to<coords::omt>( location ) ),
-                            location,
-                            weather.winddirection, false ) * to_turns<int>( tick_size );
+        data.wind_amount += windpower * to_turns<int>( tick_size );
     }
     return data;
 }
@@ -557,7 +561,7 @@ std::string weather_forecast( const point_abs_sm &abs_sm_pos )
                                  1_hours;
     for( int d = 0; d < 6; d++ ) {
         weather_type_id forecast = WEATHER_NULL;
-        const weather_generator wgen = get_weather().get_cur_weather_gen();
+        const weather_generator &wgen = get_weather().get_cur_weather_gen();
         for( time_point i = last_hour + d * 12_hours; i < last_hour + ( d + 1 ) * 12_hours; i += 1_hours ) {
             w_point w = wgen.get_weather( abs_ms_pos, i, g->get_seed() );
             *weather.weather_precise = w;
@@ -945,6 +949,49 @@ void weather_manager::update_weather()
     }
 }
 
+units::temperature weather_timeline::temperature( const weather_generator &wgen,
+        const unsigned seed, const tripoint &location, const time_point &t )
+{
+    const time_point hour = t - ( t - calendar::turn_zero ) % 1_hours;
+    sample &s = get_sample( wgen, seed, ms_to_omt_copy( location.xy() ), hour );
+    if( !s.temperature ) {
+        const tripoint omt_origin( omt_to_ms_copy( ms_to_omt_copy( location.xy() ) ), location.z );
+        s.temperature = wgen.get_weather_temperature( omt_origin, hour, seed );
+    }
+    return *s.temperature;
+}
+
+weather_type_id weather_timeline::conditions( const weather_generator &wgen, const unsigned seed,
+        const tripoint_abs_ms &location, const time_point &t )
+{
+    const time_point hour = t - ( t - calendar::turn_zero ) % 1_hours;
+    const tripoint_abs_omt omt = project_to<coords::omt>( location );
+    sample &s = get_sample( wgen, seed, omt.raw().xy(), hour );
+    if( !s.conditions ) {
+        s.conditions = wgen.get_weather_conditions( project_to<coords::ms>( omt ), hour, seed );
+    }
+    return *s.conditions;
+}
+
+weather_timeline::sample &weather_timeline::get_sample( const weather_generator &wgen,
+        const unsigned seed, const point &omt, const time_point &hour )
+{
+    // Enough for a month of hours on about 180 overmap terrains, start over beyond that
+    static constexpr size_t max_samples = 1 << 17;
+    if( sampled_wgen != &wgen || sampled_seed != seed || samples.size() >= max_samples ) {
+        clear();
+        sampled_wgen = &wgen;
+        sampled_seed = seed;
+    }
+    return samples[std::make_pair( omt, to_hours<int>( hour - calendar::turn_zero ) )];
+}
+
+void weather_timeline::clear()
+{
+    samples.clear();
+    sampled_wgen = nullptr;
+}
+
 void weather_manager::set_nextweather( time_point t )
 {
     nextweather = t;
@@ -3,11 +3,14 @@
 #define CATA_SRC_WEATHER_H
 
 #include <optional>
+#include <unordered_map>
+#include <utility>
 
 #include "calendar.h"
 #include "catacharset.h"
 #include "color.h"
 #include "coords_fwd.h"
+#include "hash_utils.h"
 #include "pimpl.h"
 #include "point.h"
 #include "type_id.h"
@@ -195,6 +198,41 @@ float incident_sun_irradiance( const weather_type_id &wtype,
 
 void weather_sound( const translation &sound_message, const std::string &sound_effect );
 
+/**
+ * The weather of the past (or future), sampled once per overmap terrain and hour.
+ *
+ * Catching up on what happened to an item, funnel or solar panel outside the reality bubble
+ * needs the weather of every hour it was away. The noise functions of the weather generator
+ * are expensive and everything on the same overmap terrain asks for the same hours, so the
+ * samples are kept and shared. Within an hour and an overmap terrain the weather is treated
+ * as constant, which is well below the resolution of the generator's noise.
+ */
+class weather_timeline
+{
+    public:
+        /** Outdoor temperature at @p location (map square coordinates) at time @p t. */
+        units::temperature temperature( const weather_generator &wgen, unsigned seed,
+                                        const tripoint &location, const time_point &t );
+        /** Weather type at @p location at time @p t. */
+        weather_type_id conditions( const weather_generator &wgen, unsigned seed,
+                                    const tripoint_abs_ms &location, const time_point &t );
+        void clear();
+
+    private:
+        struct sample {
+            std::optional<units::temperature> temperature;
+            std::optional<weather_type_id> conditions;
+        };
+        sample &get_sample( const weather_generator &wgen, unsigned seed, const point &omt,
+                            const time_point &hour );
+
+        // Samples are only valid for the generator and seed they were made with
+        const weather_generator *sampled_wgen = nullptr;
+        unsigned sampled_seed = 0;
+        // Keyed by overmap terrain and hours since turn zero
+        std::unordered_map<std::pair<point, int>, sample, cata::tuple_hash> samples;
+};
+
 class weather_manager
 {
     public:
@@ -223,6 +261,8 @@ class weather_manager
         time_point nextweather;
         /** temperature cache, cleared every turn, sparse map of map tripoints to temperatures */
         std::unordered_map< tripoint, units::temperature > temperature_cache;
+        /** Shared weather samples for catching up on time spent outside the reality bubble */
+        weather_timeline timeline;
         // Returns outdoor or indoor temperature of given location
         units::temperature get_temperature( const tripoint &location );
         // Returns outdoor or indoor temperature of given location
@@ -0,0 +1,105 @@
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "async_save.h"
+#include "cata_catch.h"
+#include "cata_path.h"
+#include "cata_utility.h"
+#include "filesystem.h"
+#include "flexbuffer_json.h"
+#include "options_helpers.h"
+#include "path_info.h"
+
+TEST_CASE( "async_save_writes_files_in_the_background", "[async_save]" )
+{
+    // drop reports of anything saved before
+    async_save::wait_all();
+    async_save::finished();
+
+    const std::string path = PATH_INFO::savedir() + "async_save_test.txt";
+    const std::string bad_path = PATH_INFO::savedir() + "async_save_test_missing/test.txt";
+    {
+        async_save::batch background;
+        REQUIRE( async_save::deferring() );
+        for( int i = 0; i < 3; ++i ) {
+            CHECK( write_to_file( path, [i]( std::ostream & fout ) {
+                fout << "contents " << i;
+            }, "test data" ) );
+        }
+        // failures are reported once the file is actually written
+        CHECK( write_to_file( bad_path, []( std::ostream & fout ) {
+            fout << "lost";
+        }, "unwritable data" ) );
+    }
+    CHECK_FALSE( async_save::deferring() );
+
+    // reading waits for the queued writes, so the last one is seen
+    std::string contents;
+    REQUIRE( read_from_file( path, [&contents]( std::istream & fin ) {
+        std::getline( fin, contents );
+    } ) );
+    CHECK( contents == "contents 2" );
+
+    async_save::wait_all();
+    const std::vector<async_save::report> reports = async_save::finished();
+    REQUIRE( reports.size() == 1 );
+    REQUIRE( reports.front().errors.size() == 1 );
+    CHECK( reports.front().errors.front().find( "unwritable data" ) != std::string::npos );
+    CHECK( async_save::finished().empty() );
+
+    async_save::remove( fs::u8path( path ) );
+    CHECK_FALSE( file_exist( path ) );
+}
+
+TEST_CASE( "save_files_are_compressed_if_the_world_says_so", "[async_save]" )
+{
+    const cata_path path = PATH_INFO::savedir_path() / "compressed_save_test.json";
+    const std::string contents = "[\"some\", \"json\", \"some\", \"json\", \"some\", \"json\"]";
+    const auto writer = [&contents]( std::ostream & fout ) {
+        fout << contents;
+    };
+    const bool deferred = GENERATE( false, true );
+    CAPTURE( deferred );
+    for( const bool compress : { false, true } ) {
+        CAPTURE( compress );
+        override_option opt( "COMPRESS_SAVES", compress ? "true" : "false" );
+        {
+            std::optional<async_save::batch> background;
+            if( deferred ) {
+                background.emplace();
+            }
+            REQUIRE( write_to_save_file( path, writer, "test data" ) );
+        }
+
+        // the raw file starts with the gzip header only when compressed
+        std::string raw;
+        async_save::wait_for( path.get_unrelative_path() );
+        {
+            std::ifstream fin( path.get_unrelative_path(), std::ios::binary );
+            raw.assign( std::istreambuf_iterator<char>( fin ), std::istreambuf_iterator<char>() );
+        }
+        REQUIRE( raw.size() >= 2 );
+        CHECK( ( raw[0] == '\x1f' && raw[1] == '\x8b' ) == compress );
+
+        // all ways of reading it see the original contents
+        std::string read;
+        REQUIRE( read_from_file( path, [&read]( std::istream & fin ) {
+            std::getline( fin, read );
+        } ) );
+        CHECK( read == contents );
+        CHECK( read_whole_file( path ) == contents );
+        std::vector<std::string> words;
+        REQUIRE( read_from_file_json( path, [&words]( const JsonValue & jv ) {
+            for( const std::string word : jv.get_array() ) {
+                words.push_back( word );
+            }
+        } ) );
+        CHECK( words.size() == 6 );
+    }
+    async_save::remove( path.get_unrelative_path() );
+}
@@ -20,6 +20,7 @@ static const faction_id faction_your_followers( "your_followers" );
 static const itype_id itype_556( "556" );
 static const itype_id itype_ammolink223( "ammolink223" );
 static const itype_id itype_belt223( "belt223" );
+static const itype_id itype_log( "log" );
 
 static const vproto_id vehicle_prototype_shopping_cart( "shopping_cart" );
 
@@ -28,6 +29,7 @@ static const zone_type_id zone_type_LOOT_FOOD( "LOOT_FOOD" );
 static const zone_type_id zone_type_LOOT_PDRINK( "LOOT_PDRINK" );
 static const zone_type_id zone_type_LOOT_PFOOD( "LOOT_PFOOD" );
 static const zone_type_id zone_type_LOOT_UNSORTED( "LOOT_UNSORTED" );
+static const zone_type_id zone_type_LOOT_WOOD( "LOOT_WOOD" );
 static const zone_type_id zone_type_UNLOAD_ALL( "UNLOAD_ALL" );
 
 namespace
@@ -116,6 +118,41 @@ TEST_CASE( "zone_unloading_ammo_belts", "[zones][items][ammo_belt][activities][u
     }
 }
 
+TEST_CASE( "zone_sorting_overflows_to_the_next_destination", "[zones][items][activities]" )
+{
+    avatar &dummy = get_avatar();
+    map &here = get_map();
+    clear_avatar();
+    clear_map();
+
+    const tripoint_abs_ms start = here.getglobal( tripoint_east );
+    const tripoint_bub_ms near_loc = tripoint_bub_ms( tripoint_east ) + point_east * 2;
+    const tripoint_bub_ms far_loc = tripoint_bub_ms( tripoint_east ) + point_east * 4;
+    dummy.set_location( start );
+    create_tile_zone( "Unsorted", zone_type_LOOT_UNSORTED, start.raw() );
+    create_tile_zone( "Wood near", zone_type_LOOT_WOOD, here.getglobal( near_loc ).raw() );
+    create_tile_zone( "Wood far", zone_type_LOOT_WOOD, here.getglobal( far_loc ).raw() );
+
+    // Leave room for exactly two more logs on the nearer destination
+    const units::volume log_volume = item( itype_log ).volume();
+    int logs_near = 0;
+    while( here.free_volume( near_loc ) >= log_volume * 3 ) {
+        here.add_item( near_loc, item( itype_log ) );
+        logs_near++;
+    }
+    REQUIRE( here.free_volume( near_loc ) >= log_volume * 2 );
+    for( int i = 0; i < 5; ++i ) {
+        here.add_item( tripoint_east, item( itype_log ) );
+    }
+
+    dummy.assign_activity( player_activity( ACT_MOVE_LOOT ) );
+    process_activity( dummy );
+
+    CHECK( count_items_or_charges( tripoint_east, itype_log, std::nullopt ) == 0 );
+    CHECK( count_items_or_charges( near_loc.raw(), itype_log, std::nullopt ) == logs_near + 2 );
+    CHECK( count_items_or_charges( far_loc.raw(), itype_log, std::nullopt ) == 3 );
+}
+
 // Comestibles sorting is a bit awkward. Unlike other loot, they're almost
 // always inside of a container, and their sort zone changes based on their
 // shelf life and whether the container prevents rotting.
@@ -315,3 +352,27 @@ TEST_CASE( "zone_sorting_comestibles_", "[zones][items][food][activities]" )
         }
     }
 }
+
+TEST_CASE( "zone_range_queries", "[zones]" )
+{
+    clear_map();
+    zone_manager &zm = zone_manager::get_manager();
+
+    const tripoint_abs_ms origin_pos;
+    // a 3x3 zone, two to four tiles east of the origin
+    zm.add( "Food", zone_type_LOOT_FOOD, faction_your_followers, false, true,
+            tripoint( 2, -1, 0 ), tripoint( 4, 1, 0 ) );
+
+    CHECK_FALSE( zm.has_near( zone_type_LOOT_FOOD, origin_pos, 1 ) );
+    CHECK( zm.has_near( zone_type_LOOT_FOOD, origin_pos, 2 ) );
+    CHECK_FALSE( zm.has_near( zone_type_LOOT_DRINK, origin_pos ) );
+
+    CHECK_FALSE( zm.get_nearest( zone_type_LOOT_FOOD, origin_pos, 1 ).has_value() );
+    CHECK( zm.get_nearest( zone_type_LOOT_FOOD, origin_pos, 2 ) == tripoint_abs_ms( 2, 0, 0 ) );
+
+    CHECK( zm.get_near( zone_type_LOOT_FOOD, origin_pos, 1 ).empty() );
+    CHECK( zm.get_near( zone_type_LOOT_FOOD, origin_pos, 2 ).size() == 3 );
+    CHECK( zm.get_near( zone_type_LOOT_FOOD, origin_pos, 3 ).size() == 6 );
+    CHECK( zm.get_near( zone_type_LOOT_FOOD, origin_pos ).size() == 9 );
+    CHECK( zm.get_near( zone_type_LOOT_FOOD, origin_pos + tripoint_above, 2 ).size() == 3 );
+}
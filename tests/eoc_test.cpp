@@ -1,3 +1,7 @@
+#include <optional>
+#include <set>
+#include <vector>
+
 #include "avatar.h"
 #include "calendar.h"
 #include "cata_catch.h"
@@ -10,6 +14,7 @@
 #include "timed_event.h"
 #include "player_helpers.h"
 #include "point.h"
+#include "rng.h"
 
 static const activity_id ACT_ADD_VARIABLE_COMPLETE( "ACT_ADD_VARIABLE_COMPLETE" );
 static const activity_id ACT_ADD_VARIABLE_DURING( "ACT_ADD_VARIABLE_DURING" );
@@ -1328,3 +1333,81 @@ TEST_CASE( "EOC_string_test", "[eoc]" )
     CHECK( get_avatar().get_value( "npctalk_var_key2" ) == "nest3" );
     CHECK( get_avatar().get_value( "npctalk_var_key3" ) == "nest4" );
 }
+
+static std::multiset<int> pop_all_due( queued_eocs &queue, int now )
+{
+    std::multiset<int> popped;
+    while( std::optional<queued_eocs::storage_iter> due = queue.pop_due( time_point::from_turn( now ) ) ) {
+        popped.insert( to_turn<int>( ( *due )->time ) );
+        queue.discard( *due );
+    }
+    return popped;
+}
+
+TEST_CASE( "queued_eocs_dispatch_order", "[eoc]" )
+{
+    const int start = 1000;
+    // slot edges of every level, plus entries past the wheel's range
+    const std::vector<int> offsets = { 5, 0, 64, 63, 65, 7, 4096, 4095, 7, 262145, 16777216,
+                                       1073741825, 1500000000
+                                     };
+    queued_eocs queue;
+    std::multiset<int> pending;
+    for( const int offset : offsets ) {
+        queue.push( queued_eoc{ effect_on_condition_EOC_alive_test, time_point::from_turn( start + offset ), {} } );
+        pending.insert( start + offset );
+    }
+
+    for( const int now : { 999, 1000, 1005, 1007, 1070, 5095, 5096, 300000, 20000000,
+                           start + 1073741825, start + 1500000000
+                         } ) {
+        CAPTURE( now );
+        const std::multiset<int> expected( pending.begin(), pending.upper_bound( now ) );
+        pending.erase( pending.begin(), pending.upper_bound( now ) );
+        CHECK( pop_all_due( queue, now ) == expected );
+    }
+    CHECK( queue.empty() );
+
+    // rescheduled entries come back at their new time
+    queue.push( queued_eoc{ effect_on_condition_EOC_alive_test, time_point::from_turn( 2000000000 ), {} } );
+    std::optional<queued_eocs::storage_iter> due = queue.pop_due( time_point::from_turn( 2000000000 ) );
+    REQUIRE( due );
+    ( *due )->time = time_point::from_turn( 2000000100 );
+    queue.reschedule( *due );
+    CHECK( pop_all_due( queue, 2000000099 ).empty() );
+    CHECK( pop_all_due( queue, 2000000100 ).size() == 1 );
+
+    // time moving backwards does not fire entries early
+    queue.push( queued_eoc{ effect_on_condition_EOC_alive_test, time_point::from_turn( 500 ), {} } );
+    CHECK( pop_all_due( queue, 400 ).empty() );
+    CHECK( pop_all_due( queue, 500 ).size() == 1 );
+
+    // copies keep the schedule
+    queue.push( queued_eoc{ effect_on_condition_EOC_alive_test, time_point::from_turn( 700 ), {} } );
+    queued_eocs copy( queue );
+    CHECK( pop_all_due( copy, 699 ).empty() );
+    CHECK( pop_all_due( copy, 700 ).size() == 1 );
+    CHECK( queue.list.size() == 1 );
+}
+
+TEST_CASE( "queued_eocs_benchmark", "[.][eoc][benchmark]" )
+{
+    // large mods queue tens of thousands of recurring eocs
+    const int num_eocs = 50000;
+    queued_eocs queue;
+    for( int i = 0; i < num_eocs; ++i ) {
+        queue.push( queued_eoc{ effect_on_condition_EOC_alive_test, time_point::from_turn( rng( 1, 86400 ) ), {} } );
+    }
+    int now = 0;
+    BENCHMARK( "dispatch and requeue one hour" ) {
+        int dispatched = 0;
+        for( const int end = now + 3600; now < end; ++now ) {
+            while( std::optional<queued_eocs::storage_iter> due = queue.pop_due( time_point::from_turn( now ) ) ) {
+                ( *due )->time = time_point::from_turn( now + rng( 1, 86400 ) );
+                queue.reschedule( *due );
+                ++dispatched;
+            }
+        }
+        return dispatched;
+    };
+}
@@ -1,4 +1,6 @@
 #include <functional>
+#include <list>
+#include <vector>
 
 #include "cata_catch.h"
 #include "item.h"
@@ -12,6 +14,7 @@
 #include "type_id.h"
 #include "units.h"
 
+static const itype_id itype_backpack( "backpack" );
 static const itype_id itype_crowbar_pocket_test( "crowbar_pocket_test" );
 static const itype_id itype_jar_glass_sealed( "jar_glass_sealed" );
 static const itype_id itype_log( "log" );
@@ -142,3 +145,56 @@ TEST_CASE( "overflow_test_into_parent_item", "[item]" )
     }
     CHECK( contents_count == 2 );
 }
+
+template<typename Range>
+static std::vector<const item *> collect( const Range &range )
+{
+    std::vector<const item *> ret;
+    for( const item *it : range ) {
+        ret.push_back( it );
+    }
+    return ret;
+}
+
+TEST_CASE( "top_items_iterate_like_all_items_top", "[item]" )
+{
+    item tool_belt( "test_tool_belt" );
+    CHECK( tool_belt.top_items().empty() );
+    CHECK( tool_belt.top_items( pocket_type::CONTAINER ).empty() );
+
+    REQUIRE( tool_belt.put_in( item( "hammer_pocket_test" ), pocket_type::CONTAINER ).success() );
+    REQUIRE( tool_belt.put_in( item( "tongs_pocket_test" ), pocket_type::CONTAINER ).success() );
+    REQUIRE( tool_belt.put_in( item( "wrench_pocket_test" ), pocket_type::CONTAINER ).success() );
+    const item &const_belt = tool_belt;
+
+    const std::list<const item *> top = const_belt.all_items_top();
+    REQUIRE( top.size() == 3 );
+    CHECK( collect( const_belt.top_items() ) == std::vector<const item *>( top.begin(), top.end() ) );
+    CHECK( collect( tool_belt.top_items() ) == std::vector<const item *>( top.begin(), top.end() ) );
+    CHECK( collect( const_belt.top_items( pocket_type::CONTAINER ) ) ==
+           std::vector<const item *>( top.begin(), top.end() ) );
+    CHECK( tool_belt.top_items( pocket_type::MOD ).empty() );
+
+    // pockets of a container are walked one after another
+    for( const item_pocket *pocket : const_belt.get_all_contained_pockets() ) {
+        const std::list<const item *> in_pocket = pocket->all_items_top();
+        CHECK( collect( pocket->top_items() ) ==
+               std::vector<const item *>( in_pocket.begin(), in_pocket.end() ) );
+    }
+}
+
+TEST_CASE( "all_items_ptr_lists_nested_items_once", "[item]" )
+{
+    item jar( itype_jar_glass_sealed );
+    jar.force_insert_item( item( itype_pickle ), pocket_type::CONTAINER );
+    item purse( itype_purse );
+    purse.force_insert_item( jar, pocket_type::CONTAINER );
+    item backpack( itype_backpack );
+    backpack.force_insert_item( purse, pocket_type::CONTAINER );
+
+    const std::list<const item *> all = static_cast<const item &>( backpack ).all_items_ptr(
+                                            pocket_type::CONTAINER );
+    REQUIRE( all.size() == 3 );
+    CHECK( all.front()->typeId() == itype_purse );
+    CHECK( backpack.all_items_ptr( pocket_type::CONTAINER ).size() == 3 );
+}
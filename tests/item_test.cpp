@@ -5,6 +5,8 @@
 #include <initializer_list>
 #include <limits>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "avatar.h"
@@ -15,7 +17,10 @@
 #include "game.h"
 #include "item_category.h"
 #include "item_factory.h"
+#include "item_vars.h"
 #include "itype.h"
+#include "json.h"
+#include "json_loader.h"
 #include "math_defines.h"
 #include "monstergenerator.h"
 #include "mtype.h"
@@ -47,6 +52,10 @@ static const itype_id itype_test_waterproof_bag( "test_waterproof_bag" );
 
 static const json_character_flag json_flag_DEAF( "DEAF" );
 
+static const matec_id tec_WBLOCK_1( "WBLOCK_1" );
+
+static const mtype_id mon_zombie( "mon_zombie" );
+
 TEST_CASE( "item_volume", "[item]" )
 {
     // Need to pick some item here which is count_by_charges and for which each
@@ -327,6 +336,133 @@ TEST_CASE( "item_variables_round-trip_accurately", "[item]" )
     CHECK( i.get_var( "C", tripoint() ) == tripoint( 2, 3, 4 ) );
 }
 
+TEST_CASE( "item_variables_keep_their_string_form", "[item]" )
+{
+    item i( "water" );
+    i.set_var( "int", 17 );
+    i.set_var( "real", 0.125 );
+    i.set_var( "number_text", "-5" );
+    i.set_var( "text", "012" );
+    CHECK( i.get_var( "int" ) == "17" );
+    CHECK( i.get_var( "real" ) == "0.125000" );
+    CHECK( i.get_var( "number_text", 0 ) == -5 );
+    CHECK( i.get_var( "text" ) == "012" );
+    CHECK( i.get_var( "text", 0 ) == 12 );
+    CHECK( i.get_var( item_var_key( "int" ), 0 ) == 17 );
+    CHECK_FALSE( i.has_var( "missing" ) );
+    CHECK( i.get_var( "missing", 3 ) == 3 );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    i.serialize( jsout );
+    CHECK( os.str().find(
+               R"("item_vars":{"int":"17","number_text":"-5","real":"0.125000","text":"012"})" ) !=
+           std::string::npos );
+
+    item loaded;
+    loaded.deserialize( json_loader::from_string( os.str() ) );
+    CHECK( loaded.get_var( "int", 0 ) == 17 );
+    CHECK( loaded.get_var( "real", 0.0 ) == 0.125 );
+    CHECK( loaded.get_var( "text" ) == "012" );
+    CHECK( loaded.stacks_with( i ).bits[tname::segments::VARS] );
+
+    // item vars written as numbers are read as well
+    item typed;
+    typed.deserialize( json_loader::from_string(
+                           R"({"typeid":"water","item_vars":{"int":17,"real":0.125}})" ) );
+    CHECK( typed.get_var( "int" ) == "17" );
+    CHECK( typed.get_var( "real" ) == "0.125000" );
+}
+
+TEST_CASE( "item_variables_keep_their_value_across_save_and_load", "[item]" )
+{
+    item i( "water" );
+    i.set_var( "third", 1.0 / 3.0 );
+    item fresh( "water" );
+    fresh.set_var( "third", 1.0 / 3.0 );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    i.serialize( jsout );
+    item loaded;
+    loaded.deserialize( json_loader::from_string( os.str() ) );
+
+    CHECK( loaded.get_var( "third", 0.0 ) == i.get_var( "third", 0.0 ) );
+    CHECK( loaded.get_var( "third", 0.0 ) == fresh.get_var( "third", 0.0 ) );
+    CHECK( loaded.stacks_with( fresh ).bits[tname::segments::VARS] );
+    CHECK( fresh.stacks_with( loaded ).bits[tname::segments::VARS] );
+}
+
+TEST_CASE( "item_variables_benchmark", "[.][item][benchmark]" )
+{
+    std::vector<item> stash( 1000, item( "water" ) );
+    for( item &it : stash ) {
+        it.set_var( "dirt", 100 );
+        it.set_var( "gun_heat", 2.5 );
+        it.set_var( "name", "stashed water" );
+    }
+    static const item_var_key var_dirt( "dirt" );
+
+    BENCHMARK( "get_var by name" ) {
+        double total = 0;
+        for( const item &it : stash ) {
+            total += it.get_var( "dirt", 0 ) + it.get_var( "gun_heat", 0.0 );
+        }
+        return total;
+    };
+    BENCHMARK( "get_var by key" ) {
+        double total = 0;
+        for( const item &it : stash ) {
+            total += it.get_var( var_dirt, 0 );
+        }
+        return total;
+    };
+    BENCHMARK( "set_var" ) {
+        for( item &it : stash ) {
+            it.set_var( "gun_heat", 3.5 );
+        }
+        return stash.size();
+    };
+    BENCHMARK( "copy stash" ) {
+        return std::vector<item>( stash ).size();
+    };
+}
+
+TEST_CASE( "item_rarely_used_state_round-trips", "[item]" )
+{
+    item rock( "rock" );
+    const size_t plain_memory = rock.memory_usage();
+    CHECK( plain_memory >= sizeof( item ) );
+    rock.add_technique( tec_WBLOCK_1 );
+    CHECK( rock.has_technique( tec_WBLOCK_1 ) );
+    CHECK( rock.memory_usage() > plain_memory );
+    CHECK_FALSE( rock.stacks_with( item( "rock" ) ) );
+
+    item corpse = item::make_corpse( mon_zombie, calendar::turn, "Bob" );
+    CHECK( corpse.get_corpse_name() == "Bob" );
+
+    for( const item *original : {
+             &rock, &corpse
+         } ) {
+        std::ostringstream os;
+        JsonOut jsout( os );
+        original->serialize( jsout );
+        item loaded;
+        loaded.deserialize( json_loader::from_string( os.str() ) );
+        CHECK( loaded.get_techniques() == original->get_techniques() );
+        CHECK( loaded.get_corpse_name() == original->get_corpse_name() );
+    }
+}
+
+TEST_CASE( "item_memory_usage_includes_contents", "[item]" )
+{
+    item backpack( itype_test_backpack );
+    const size_t empty_memory = backpack.memory_usage();
+    const item rock( "rock" );
+    REQUIRE( backpack.put_in( rock, pocket_type::CONTAINER ).success() );
+    CHECK( backpack.memory_usage() >= empty_memory + rock.memory_usage() );
+}
+
 TEST_CASE( "water_affect_items_while_swimming_check", "[item][water][swimming]" )
 {
     avatar &guy = get_avatar();
@@ -2,6 +2,7 @@
 #include <array>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <list>
 #include <map>
 #include <optional>
@@ -11,6 +12,7 @@
 #include <utility>
 #include <vector>
 
+#include "avatar.h"
 #include "bodypart.h"
 #include "cached_options.h"
 #include "cata_scope_helpers.h"
@@ -24,9 +26,14 @@
 #include "json.h"
 #include "json_loader.h"
 #include "magic.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapbuffer.h"
 #include "mutation.h"
+#include "player_helpers.h"
 #include "sounds.h"
 #include "string_formatter.h"
+#include "submap.h"
 #include "translations.h"
 #include "type_id.h"
 
@@ -36,6 +43,7 @@ static const field_type_str_id field_test_field( "test_field" );
 
 static const flag_id json_flag_DIRTY( "DIRTY" );
 
+static const itype_id itype_backpack_giant( "backpack_giant" );
 static const itype_id itype_test_rag( "test_rag" );
 
 static const mtype_id foo( "foo" );
@@ -81,6 +89,38 @@ TEST_CASE( "avoid_serializing_default_values", "[json]" )
     REQUIRE( os.str() == "\"bar\":\"foo\"" );
 }
 
+TEST_CASE( "jsonout_formats_numbers_and_strings", "[json]" )
+{
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.start_array();
+    jsout.write( 0 );
+    jsout.write( -12345 );
+    jsout.write( std::numeric_limits<int64_t>::min() );
+    jsout.write( 42u );
+    jsout.write( true );
+    jsout.write( false );
+    jsout.write( 1.5 );
+    jsout.write( -0.25f );
+    jsout.write( 1e20 );
+    jsout.write( "plain/text" );
+    jsout.write( "\"quoted\"\\\n\t\x01" );
+    jsout.end_array();
+    // writing to the stream directly keeps the order
+    os << "|";
+    jsout.write( "after" );
+    CHECK( os.str() ==
+           R"([0,-12345,-9223372036854775808,42,true,false,1.500000,-0.250000,)"
+           R"(100000000000000000000.000000,"plain/text","\"quoted\"\\\n\t\u0001"]|,"after")" );
+
+    // the precision of the stream is kept, with the decimal point written even at none
+    std::ostringstream os_rounded;
+    JsonOut jsout_rounded( os_rounded );
+    os_rounded.precision( 0 );
+    jsout_rounded.write( 2.0 );
+    CHECK( os_rounded.str() == "2." );
+}
+
 TEST_CASE( "spell_type_handles_all_members", "[json]" )
 {
     const spell_type &test_spell = spell_test_spell_json.obj();
@@ -947,3 +987,40 @@ TEST_CASE( "serialize_optional", "[json]" )
         test_serialization( v, "[1,2,3]" );
     }
 }
+
+TEST_CASE( "jsonout_benchmark", "[.][json][benchmark]" )
+{
+    clear_map();
+    clear_avatar();
+    avatar &you = get_avatar();
+    REQUIRE( you.wear_item( item( itype_backpack_giant ) ) );
+    for( int i = 0; i < 500; ++i ) {
+        you.i_add( item( itype_test_rag ) );
+    }
+    // something to put in the submaps besides terrain
+    map &here = get_map();
+    for( const tripoint &p : here.points_on_zlevel( 0 ) ) {
+        if( p.x % 4 == 0 && p.y % 4 == 0 ) {
+            here.add_item( p, item( itype_test_rag ) );
+        }
+    }
+
+    BENCHMARK( "serialize mapbuffer" ) {
+        std::ostringstream os;
+        JsonOut jsout( os );
+        jsout.start_array();
+        for( const auto &sm : MAPBUFFER ) {
+            jsout.start_object();
+            sm.second->store( jsout );
+            jsout.end_object();
+        }
+        jsout.end_array();
+        return os.str().size();
+    };
+    BENCHMARK( "serialize character" ) {
+        std::ostringstream os;
+        JsonOut jsout( os );
+        jsout.write( you );
+        return os.str().size();
+    };
+}
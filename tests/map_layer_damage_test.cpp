@@ -0,0 +1,115 @@
+#if defined(TILES)
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "cata_catch.h"
+#include "cata_tiles.h"
+#include "point.h"
+
+static constexpr int cell_size = 32;
+
+// Lays out `layers` ops per cell on a `size` grid, shifted by `scroll` pixels
+static map_layer_frame make_frame( const std::array<texture, 3> &textures, const point &size,
+                                   int layers, int scroll )
+{
+    map_layer_frame frame;
+    for( int layer = 0; layer < layers; ++layer ) {
+        for( int y = 0; y < size.y; ++y ) {
+            for( int x = 0; x < size.x; ++x ) {
+                map_draw_op &op = frame.ops.emplace_back();
+                op.cell = tripoint( x, y, 0 );
+                op.tex = &textures[layer % textures.size()];
+                op.dst = SDL_Rect{ x * cell_size + scroll, y * cell_size - layer * 4,
+                                   cell_size, cell_size + 4 };
+            }
+        }
+    }
+    frame.index();
+    return frame;
+}
+
+static int64_t area_of( const std::vector<SDL_Rect> &damage )
+{
+    int64_t area = 0;
+    for( const SDL_Rect &r : damage ) {
+        area += static_cast<int64_t>( r.w ) * r.h;
+    }
+    return area;
+}
+
+TEST_CASE( "map_layer_damage_tracks_changed_cells", "[tiles]" )
+{
+    const std::array<texture, 3> textures;
+    const point size( 20, 15 );
+    const int64_t screen_area = static_cast<int64_t>( size.x ) * size.y * cell_size * cell_size;
+    const map_layer_frame prev = make_frame( textures, size, 3, 0 );
+
+    SECTION( "an unchanged scene is not redrawn" ) {
+        const map_layer_frame cur = make_frame( textures, size, 3, 0 );
+        const std::optional<std::vector<SDL_Rect>> damage = map_layer_damage( prev, cur, 16,
+                screen_area );
+        REQUIRE( damage );
+        CHECK( damage->empty() );
+    }
+
+    SECTION( "a creature stepping damages the cells it left and entered" ) {
+        map_layer_frame cur = make_frame( textures, size, 3, 0 );
+        map_draw_op &critter = cur.ops.emplace_back();
+        critter.cell = tripoint( 5, 5, 0 );
+        critter.tex = &textures[0];
+        critter.dst = SDL_Rect{ 5 * cell_size, 5 * cell_size, cell_size, cell_size };
+        cur.index();
+        map_layer_frame next = make_frame( textures, size, 3, 0 );
+        map_draw_op &moved = next.ops.emplace_back( critter );
+        moved.cell = tripoint( 10, 8, 0 );
+        moved.dst = SDL_Rect{ 10 * cell_size, 8 * cell_size, cell_size, cell_size };
+        next.index();
+
+        const std::optional<std::vector<SDL_Rect>> damage = map_layer_damage( cur, next, 16,
+                screen_area );
+        REQUIRE( damage );
+        // both cells, each including the taller sprites stacked on them
+        CHECK( damage->size() == 2 );
+        CHECK( area_of( *damage ) == 2 * cell_size * ( cell_size + 12 ) );
+    }
+
+    SECTION( "a removed sprite damages its cell" ) {
+        map_layer_frame cur = make_frame( textures, size, 3, 0 );
+        cur.ops.erase( cur.ops.begin() + size.x * size.y + 3 );
+        cur.index();
+        const std::optional<std::vector<SDL_Rect>> damage = map_layer_damage( prev, cur, 16,
+                screen_area );
+        REQUIRE( damage );
+        REQUIRE( damage->size() == 1 );
+        CHECK( damage->front().x == 3 * cell_size );
+    }
+
+    SECTION( "scrolling the view falls back to a full redraw" ) {
+        const map_layer_frame cur = make_frame( textures, size, 3, 1 );
+        CHECK_FALSE( map_layer_damage( prev, cur, 16, screen_area / 2 ) );
+    }
+}
+
+TEST_CASE( "map_layer_damage_benchmark", "[.][tiles][benchmark]" )
+{
+    const std::array<texture, 3> textures;
+    const point size( 60, 40 );
+    const int64_t screen_area = static_cast<int64_t>( size.x ) * size.y * cell_size * cell_size;
+    const map_layer_frame prev = make_frame( textures, size, 3, 0 );
+    map_layer_frame cur = make_frame( textures, size, 3, 0 );
+
+    BENCHMARK( "static scene" ) {
+        cur.index();
+        return map_layer_damage( prev, cur, 16, screen_area / 2 ).has_value();
+    };
+    cur.ops[size.x * 20 + 30].tex = &textures[1];
+    BENCHMARK( "one changed cell" ) {
+        cur.index();
+        return map_layer_damage( prev, cur, 16, screen_area / 2 ).has_value();
+    };
+}
+
+#endif // TILES
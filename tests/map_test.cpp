@@ -12,7 +12,9 @@
 #include "game.h"
 #include "game_constants.h"
 #include "map_helpers.h"
+#include "mapbuffer.h"
 #include "point.h"
+#include "rng.h"
 #include "submap.h"
 #include "type_id.h"
 
@@ -177,6 +179,41 @@ TEST_CASE( "place_player_can_safely_move_multiple_submaps" )
     get_map().check_submap_active_item_consistency();
 }
 
+TEST_CASE( "map_shift_pregenerates_leading_edge", "[map]" )
+{
+    clear_map();
+    map &here = get_map();
+    const on_out_of_scope restore_shift( [&here]() {
+        here.shift( point_rel_sm_west );
+        while( here.pregenerate_next() ) {}
+        // the submaps loaded by the shifts hold freshly generated terrain
+        clear_map();
+    } );
+
+    here.shift( point_rel_sm_east );
+    const tripoint_abs_sm abs_sub = here.get_abs_sub();
+    const tripoint_abs_omt ahead(
+        project_to<coords::omt>( abs_sub.xy() + point( MAPSIZE - 1, MAPSIZE / 2 ) ) + point_east,
+        abs_sub.z() );
+    CAPTURE( ahead );
+
+    // the global random number generator is left as it was
+    const cata_default_random_engine engine_before = rng_get_engine();
+    while( here.pregenerate_next() ) {}
+    CHECK( rng_get_engine() == engine_before );
+
+    const tripoint_abs_sm ahead_sm = project_to<coords::sm>( ahead );
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        CHECK( MAPBUFFER.lookup_submap( tripoint_abs_sm( ahead_sm.xy(), z ) ) != nullptr );
+    }
+
+    // loading the map drops the tiles queued around its old location
+    here.shift( point_rel_sm_east );
+    here.load( here.get_abs_sub(), false );
+    CHECK_FALSE( here.pregenerate_next() );
+    here.shift( point_rel_sm_west );
+}
+
 TEST_CASE( "inactive_container_with_active_contents", "[active_item][map]" )
 {
     map &here = get_map();
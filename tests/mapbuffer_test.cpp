@@ -0,0 +1,129 @@
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "async_save.h"
+#include "cata_catch.h"
+#include "cata_scope_helpers.h"
+#include "coordinates.h"
+#include "coordinate_constants.h"
+#include "filesystem.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapbuffer.h"
+#include "options_helpers.h"
+#include "path_info.h"
+#include "submap.h"
+#include "type_id.h"
+
+static const ter_str_id ter_t_dirt( "t_dirt" );
+static const ter_str_id ter_t_floor( "t_floor" );
+
+TEST_CASE( "mapbuffer_save_only_rewrites_changed_quads", "[map][mapbuffer]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint_bub_ms p( 30, 30, 0 );
+    here.ter_set( p, ter_t_floor );
+
+    MAPBUFFER.save();
+    REQUIRE( MAPBUFFER.last_save_stats().quads_written > 0 );
+
+    WHEN( "nothing changed" ) {
+        MAPBUFFER.save();
+        THEN( "no quad is rewritten" ) {
+            const mapbuffer::save_stats &stats = MAPBUFFER.last_save_stats();
+            CHECK( stats.quads_written == 0 );
+            CHECK( stats.bytes_written == 0 );
+            CHECK( stats.quads_unchanged > 0 );
+        }
+    }
+
+    WHEN( "a single tile changed" ) {
+        here.ter_set( p, ter_t_dirt );
+        MAPBUFFER.save();
+        THEN( "only its quad is rewritten" ) {
+            const mapbuffer::save_stats &stats = MAPBUFFER.last_save_stats();
+            CHECK( stats.quads_written == 1 );
+            CHECK( stats.bytes_written > 0 );
+        }
+    }
+}
+
+TEST_CASE( "mapbuffer_saves_submaps_shifted_off_the_map", "[map][mapbuffer]" )
+{
+    clear_map();
+    map &here = get_map();
+    const on_out_of_scope restore_shift( [&here]() {
+        here.shift( point_rel_sm_west );
+        here.shift( point_rel_sm_west );
+    } );
+    // A tile in the leftmost column of submaps, which leaves the map after two shifts east
+    const tripoint_bub_ms p( 5, 30, 0 );
+    const tripoint_abs_sm p_sm = project_to<coords::sm>( here.getglobal( p ) );
+    const point_sm_ms p_in_sm( p.x() % SEEX, p.y() % SEEY );
+    MAPBUFFER.save();
+
+    // Changed in place, as the game does, after the last save
+    here.ter_set( p, ter_t_floor );
+    here.shift( point_rel_sm_east );
+    here.shift( point_rel_sm_east );
+    REQUIRE_FALSE( here.inbounds( project_to<coords::omt>( p_sm ) ) );
+    MAPBUFFER.save();
+    MAPBUFFER.clear_outside_reality_bubble();
+
+    submap *const sm = MAPBUFFER.lookup_submap( p_sm );
+    REQUIRE( sm != nullptr );
+    CHECK( sm->get_ter( p_in_sm ) == ter_t_floor );
+}
+
+static size_t saved_map_bytes()
+{
+    size_t bytes = 0;
+    const fs::path maps_dir = fs::u8path( PATH_INFO::world_base_save_path() + "/maps" );
+    for( const fs::directory_entry &entry : fs::recursive_directory_iterator( maps_dir ) ) {
+        if( entry.is_regular_file() ) {
+            bytes += entry.file_size();
+        }
+    }
+    return bytes;
+}
+
+TEST_CASE( "mapbuffer_compressed_save_benchmark", "[.][map][mapbuffer][benchmark]" )
+{
+    clear_map();
+    // Generate a few reality bubbles worth of terrain next to the real one
+    for( int i = 1; i <= 4; ++i ) {
+        map m;
+        m.load( get_map().get_abs_sub() + point( i * MAPSIZE_X, 0 ), false );
+    }
+    std::vector<tripoint_abs_sm> generated;
+    for( const auto &sm : MAPBUFFER ) {
+        generated.push_back( sm.first );
+    }
+
+    for( const std::string compress : { "false", "true" } ) {
+        override_option opt( "COMPRESS_SAVES", compress );
+        // Every quad is rewritten, not only the changed ones
+        for( auto &sm : MAPBUFFER ) {
+            sm.second->mark_modified();
+        }
+        const std::chrono::steady_clock::time_point save_start = std::chrono::steady_clock::now();
+        MAPBUFFER.save();
+        async_save::wait_all();
+        const std::chrono::steady_clock::time_point load_start = std::chrono::steady_clock::now();
+        MAPBUFFER.clear_outside_reality_bubble();
+        for( const tripoint_abs_sm &p : generated ) {
+            CHECK( MAPBUFFER.lookup_submap( p ) != nullptr );
+        }
+        const std::chrono::steady_clock::time_point load_end = std::chrono::steady_clock::now();
+
+        const auto ms = []( std::chrono::steady_clock::duration d ) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>( d ).count();
+        };
+        WARN( "COMPRESS_SAVES " << compress << ": " << generated.size() << " submaps, "
+              << saved_map_bytes() << " bytes on disk, saved in " << ms( load_start - save_start )
+              << " ms, loaded in " << ms( load_end - load_start ) << " ms" );
+    }
+}
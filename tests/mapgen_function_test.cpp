@@ -1,5 +1,15 @@
 #include "cata_catch.h"
 
+#include <map>
+#include <string>
+#include <utility>
+
+#include "calendar.h"
+#include "coordinates.h"
+#include "debug.h"
+#include "map.h"
+#include "omdata.h"
+#include "overmapbuffer.h"
 #include "type_id.h"
 
 static const oter_str_id oter_sewer_es( "sewer_es" );
@@ -139,3 +149,32 @@ TEST_CASE( "connects_to", "[mapgen][connects]" )
         CHECK( connects_to( oter_id( "sewer_nesw" ), west ) );
     }
 }
+
+TEST_CASE( "generate_every_mapgen_id", "[.][mapgen][benchmark]" )
+{
+    // One overmap terrain for each distinct mapgen id
+    std::map<std::string, oter_id> terrains;
+    for( const oter_t &ter : overmap_terrains::get_all() ) {
+        const std::string mapgen_id = ter.get_mapgen_id();
+        if( !mapgen_id.empty() ) {
+            terrains.emplace( mapgen_id, ter.id.id() );
+        }
+    }
+    REQUIRE( !terrains.empty() );
+
+    const tripoint_abs_omt pos( 100, 100, 0 );
+    const oter_id old_ter = overmap_buffer.ter( pos );
+
+    BENCHMARK( "generate" ) {
+        return capture_debugmsg_during( [&]() {
+            for( const std::pair<const std::string, oter_id> &ter : terrains ) {
+                overmap_buffer.ter_set( pos, ter.second );
+                smallmap tm;
+                tm.generate( pos, calendar::turn, false );
+                tm.delete_unmerged_submaps();
+            }
+        } ).size();
+    };
+
+    overmap_buffer.ter_set( pos, old_ter );
+}
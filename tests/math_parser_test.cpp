@@ -2,12 +2,16 @@
 
 #include <cmath>
 #include <locale>
+#include <sstream>
 
 #include "avatar.h"
 #include "dialogue.h"
 #include "global_vars.h"
+#include "json.h"
+#include "json_loader.h"
 #include "math_parser.h"
 #include "math_parser_func.h"
+#include "var_value.h"
 
 static const skill_id skill_survival( "survival" );
 
@@ -345,3 +349,111 @@ TEST_CASE( "math_parser_dialogue_integration", "[math_parser]" )
         CHECK_FALSE( testexp.parse( "val( 'stamina' ) * 3", true ) ); // eval expression in assignment tree
     } );
 }
+
+TEST_CASE( "math_parser_compiled_matches_tree", "[math_parser]" )
+{
+    dialogue d( std::make_unique<talker>(), std::make_unique<talker>() );
+    math_exp testexp;
+    global_variables &globvars = get_globals();
+    globvars.set_global_value( "npctalk_var_a", "0" );
+    globvars.set_global_value( "npctalk_var_b", "3" );
+
+    // non-constant ternaries exercise the conditional jumps
+    CHECK( testexp.parse( "a?b:b*2" ) );
+    CHECK( testexp.eval( d ) == Approx( 6 ) );
+    CHECK( testexp.parse( "b?a?-1:-2:1" ) );
+    CHECK( testexp.eval( d ) == Approx( -2 ) );
+    CHECK( testexp.parse( "(a==0?b:2)?4:5" ) );
+    CHECK( testexp.eval( d ) == Approx( 4 ) );
+    CHECK( testexp.parse( "max(a, b, 2 + b) - min(b, 1 + 1) * -b" ) );
+    CHECK( testexp.eval( d ) == Approx( 11 ) );
+    CHECK( testexp.parse( "clamp(b ^ 2, 2 * 2, 2 ^ 3)" ) );
+    CHECK( testexp.eval( d ) == Approx( 8 ) );
+    // deep nesting falls back to the tree walker
+    CHECK( testexp.parse( "b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+(b+"
+                          "(b+(b+(b+(b+(b+(b+(b+(b+(b+b))))))))))))))))))))))))))))))))" ) );
+    CHECK( testexp.eval( d ) == Approx( 102 ) );
+    // rng is not folded at parse time
+    CHECK( testexp.parse( "rng(1, 2)" ) );
+    double const r = testexp.eval( d );
+    CHECK( r >= 1 );
+    CHECK( r <= 2 );
+
+    globvars.set_global_value( "npctalk_var_a", "1" );
+    CHECK( testexp.parse( "a?b:b*2" ) );
+    CHECK( testexp.eval( d ) == Approx( 3 ) );
+}
+
+TEST_CASE( "math_parser_typed_variables", "[math_parser]" )
+{
+    standard_npc dude;
+    dialogue d( get_talker_for( get_avatar() ), get_talker_for( &dude ) );
+    math_exp testexp;
+    global_variables &globvars = get_globals();
+
+    // numeric writes keep full precision for math but format like before for strings
+    for( std::string_view const var : { "typed", "u_typed", "n_typed" } ) {
+        CAPTURE( var );
+        CHECK( testexp.parse( var, true ) );
+        testexp.assign( d, 1234567.5 );
+        CHECK( testexp.parse( var ) );
+        CHECK( testexp.eval( d ) == 1234567.5 );
+    }
+    CHECK( globvars.get_global_value( "npctalk_var_typed" ) == "1.23457e+06" );
+    CHECK( get_avatar().get_value( "npctalk_var_typed" ) == "1.23457e+06" );
+    CHECK( dude.get_value( "npctalk_var_typed" ) == "1.23457e+06" );
+
+    // string writes are parsed once on the first numeric read
+    globvars.set_global_value( "npctalk_var_typed", "42" );
+    CHECK( testexp.parse( "typed * 2" ) );
+    CHECK( testexp.eval( d ) == Approx( 84 ) );
+    globvars.set_global_value( "npctalk_var_typed", "fourty-two" );
+    std::string const dmsg = capture_debugmsg_during( [&testexp, &d]() {
+        CHECK( testexp.eval( d ) == Approx( 0 ) );
+    } );
+    CHECK( dmsg.find( "failed to convert" ) != std::string::npos );
+
+    // saves always contain the string form
+    var_value const num( 2.5 );
+    std::ostringstream os;
+    JsonOut jsout( os );
+    num.serialize( jsout );
+    CHECK( os.str() == R"("2.5")" );
+    std::string const saved = os.str();
+    var_value loaded;
+    loaded.deserialize( json_loader::from_string( saved ) );
+    REQUIRE( loaded.get_num() );
+    CHECK( *loaded.get_num() == 2.5 );
+    CHECK( loaded.get_str() == "2.5" );
+
+    // numbers keep their precision across a save and load, even after being read as strings
+    for( double const val : { 1234567.5, 0.1, 1.0 / 3.0 } ) {
+        CAPTURE( val );
+        var_value const precise( val );
+        precise.get_str();
+        std::ostringstream precise_os;
+        JsonOut precise_jsout( precise_os );
+        precise.serialize( precise_jsout );
+        var_value precise_loaded;
+        precise_loaded.deserialize( json_loader::from_string( precise_os.str() ) );
+        REQUIRE( precise_loaded.get_num() );
+        CHECK( *precise_loaded.get_num() == val );
+        CHECK( precise_loaded.get_str() == precise.get_str() );
+    }
+}
+
+TEST_CASE( "math_parser_eval_benchmark", "[.][math_parser][benchmark]" )
+{
+    dialogue d( std::make_unique<talker>(), std::make_unique<talker>() );
+    math_exp testexp;
+    get_globals().set_global_value( "npctalk_var_bench", "7" );
+
+    REQUIRE( testexp.parse( "bench > 5 ? clamp( bench * 2 + 3 ^ 2, 0, 100 ) : -bench" ) );
+    BENCHMARK( "variable and functions" ) {
+        return testexp.eval( d );
+    };
+    REQUIRE( testexp.parse( "max( 1 + 2 * 3, sqrt( 16 ), 2 ^ 3 ) - ( 1 ? 2 : 3 )" ) );
+    BENCHMARK( "constant expression" ) {
+        return testexp.eval( d );
+    };
+}
@@ -1,12 +1,18 @@
+#include <cstdlib>
+#include <vector>
+
 #include "calendar.h"
 #include "cata_catch.h"
 #include "enums.h"
+#include "game_constants.h"
 #include "item.h"
 #include "map.h"
+#include "pocket_type.h"
 #include "point.h"
 #include "type_id.h"
 #include "weather.h"
 
+static const flag_id json_flag_COLD( "COLD" );
 static const flag_id json_flag_FROZEN( "FROZEN" );
 
 static void set_map_temperature( units::temperature new_temperature )
@@ -134,3 +140,61 @@ TEST_CASE( "Hourly_rotpoints", "[rot]" )
     CHECK( normal_item.calc_hourly_rotpoints_at_temp( units::from_fahrenheit( 107 ) ) == Approx(
                20364.67 ) );
 }
+
+TEST_CASE( "food_in_a_pocket_rots_like_food_on_its_own", "[rot]" )
+{
+    if( calendar::turn <= calendar::start_of_cataclysm ) {
+        calendar::turn = calendar::start_of_cataclysm + 1_minutes;
+    }
+    const time_duration away = GENERATE( 3_hours, 2_days, 10_days );
+    CAPTURE( to_hours<int>( away ) );
+
+    item loose( "meat_cooked" );
+    item bag( "bag_plastic" );
+    for( int i = 0; i < 5; ++i ) {
+        REQUIRE( bag.put_in( item( "meat_cooked" ), pocket_type::CONTAINER ).success() );
+    }
+    loose.process( get_map(), nullptr, tripoint_zero, 1, temperature_flag::FRIDGE );
+    bag.process( get_map(), nullptr, tripoint_zero, 1, temperature_flag::FRIDGE );
+    // COLD items catch up hour by hour, in a fridge the flag does not change their rot
+    loose.set_flag( json_flag_COLD );
+
+    calendar::turn += away;
+    loose.process( get_map(), nullptr, tripoint_zero, 1, temperature_flag::FRIDGE );
+    bag.process( get_map(), nullptr, tripoint_zero, 1, temperature_flag::FRIDGE );
+    calendar::turn -= away;
+
+    REQUIRE( loose.get_rot() > 0_turns );
+    // Rot is truncated to whole turns once for all hours summed up, instead of every hour
+    for( const item *meat : bag.all_items_top( pocket_type::CONTAINER ) ) {
+        CHECK( std::abs( to_turns<int>( meat->get_rot() - loose.get_rot() ) ) <=
+               to_hours<int>( away ) );
+    }
+}
+
+TEST_CASE( "out_of_bubble_rot_benchmark", "[.][rot][benchmark]" )
+{
+    if( calendar::turn <= calendar::start_of_cataclysm ) {
+        calendar::turn = calendar::start_of_cataclysm + 1_minutes;
+    }
+    // A submap full of food, last processed when its owner left 30 days ago
+    std::vector<item> food;
+    for( int i = 0; i < SEEX * SEEY; ++i ) {
+        food.emplace_back( "meat_cooked" );
+        food.back().process( get_map(), nullptr, tripoint( i % SEEX, i / SEEX, 0 ), 1,
+                             temperature_flag::NORMAL );
+    }
+    calendar::turn += 30_days;
+
+    BENCHMARK( "catch up on 30 days" ) {
+        get_weather().timeline.clear();
+        std::vector<item> loaded = food;
+        int rotten = 0;
+        for( int i = 0; i < SEEX * SEEY; ++i ) {
+            rotten += loaded[i].process_temperature_rot( 1, tripoint( i % SEEX, i / SEEX, 0 ), get_map(),
+                      nullptr );
+        }
+        return rotten;
+    };
+    calendar::turn -= 30_days;
+}
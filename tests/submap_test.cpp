@@ -115,3 +115,63 @@ TEST_CASE( "submap_rotation2", "[submap]" )
         }
     }
 }
+
+TEST_CASE( "submap_shared_layers_copy_on_write", "[submap]" )
+{
+    constexpr point_sm_ms corner_1{};
+    constexpr point_sm_ms corner_3 = { SEEX - 1, SEEY - 1 };
+
+    const auto fill = [&]( submap & sm ) {
+        sm.set_ter( corner_1, ter_id( 1 ) );
+        sm.set_ter( corner_3, ter_id( 3 ) );
+        sm.set_radiation( corner_3, 10 );
+        sm.share_layers();
+    };
+    submap sm_a;
+    submap sm_b;
+    fill( sm_a );
+    fill( sm_b );
+
+    WHEN( "one of the submaps is modified" ) {
+        sm_a.set_ter( corner_1, ter_id( 2 ) );
+        sm_a.set_radiation( corner_3, 0 );
+
+        THEN( "the other keeps its contents" ) {
+            CHECK( sm_a.get_ter( corner_1 ) == ter_id( 2 ) );
+            CHECK( sm_a.get_radiation( corner_3 ) == 0 );
+            CHECK( sm_b.get_ter( corner_1 ) == ter_id( 1 ) );
+            CHECK( sm_b.get_radiation( corner_3 ) == 10 );
+        }
+    }
+
+    WHEN( "one of the submaps is rotated" ) {
+        sm_b.rotate( 2 );
+
+        THEN( "the other keeps its orientation" ) {
+            CHECK( sm_a.get_ter( corner_1 ) == ter_id( 1 ) );
+            CHECK( sm_a.get_ter( corner_3 ) == ter_id( 3 ) );
+            CHECK( sm_b.get_ter( corner_1 ) == ter_id( 3 ) );
+            CHECK( sm_b.get_ter( corner_3 ) == ter_id( 1 ) );
+        }
+    }
+}
+
+TEST_CASE( "submap_shared_layers_are_forgotten_when_unused", "[submap]" )
+{
+    maptile_soa::drop_unused_shared_layers();
+    const size_t in_use = maptile_soa::shared_layers_count();
+    {
+        submap sm_a;
+        submap sm_b;
+        sm_a.set_ter( point_sm_ms(), ter_id( 1 ) );
+        sm_b.set_ter( point_sm_ms(), ter_id( 2 ) );
+        // Unlike anything a real submap would hold, so nothing else shares these layers
+        sm_a.set_radiation( point_sm_ms(), 12345 );
+        sm_b.set_radiation( point_sm_ms(), 12345 );
+        sm_a.share_layers();
+        sm_b.share_layers();
+        CHECK( maptile_soa::shared_layers_count() == in_use + 2 );
+    }
+    maptile_soa::drop_unused_shared_layers();
+    CHECK( maptile_soa::shared_layers_count() == in_use );
+}
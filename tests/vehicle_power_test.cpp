@@ -10,7 +10,10 @@
 #include "point.h"
 #include "type_id.h"
 #include "units.h"
+#include "veh_type.h"
 #include "vehicle.h"
+#include "vpart_position.h"
+#include "vpart_range.h"
 #include "weather.h"
 #include "weather_type.h"
 
@@ -130,6 +133,30 @@ TEST_CASE( "power_loss_to_cables", "[vehicle][power]" )
         const int deficit = v.discharge_battery( preset.discharge );
         CHECK( deficit >= preset.min_discharge_deficit );
     }
+
+    // grid topology is cached, unplugging the middle vehicle has to invalidate it
+    CHECK( v.search_connected_vehicles().size() == placements.size() );
+    CHECK( v.search_connected_batteries().size() == placements.size() );
+    const optional_vpart_position ovp_middle = here.veh_at( placements[1] );
+    REQUIRE( ovp_middle.has_value() );
+    vehicle &middle = ovp_middle->vehicle();
+    std::vector<vehicle_part *> cords;
+    for( const vpart_reference &vpr : middle.get_any_parts( VPFLAG_POWER_TRANSFER ) ) {
+        cords.push_back( &vpr.part() );
+    }
+    REQUIRE( cords.size() == 2 );
+    for( vehicle_part *cord : cords ) {
+        middle.remove_part( *cord );
+    }
+    middle.part_removal_cleanup();
+    CHECK( v.search_connected_vehicles().size() == 2 );
+    CHECK( v.search_connected_batteries().size() == 2 );
+    CHECK( middle.search_connected_vehicles().size() == 1 );
+
+    // the grid of a vehicle has to forget vehicles that are gone
+    here.destroy_vehicle( &middle );
+    CHECK( v.search_connected_vehicles().size() == 1 );
+    CHECK( v.search_connected_batteries().size() == 1 );
 }
 
 TEST_CASE( "Solar_power", "[vehicle][power]" )
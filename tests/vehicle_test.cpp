@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <optional>
+#include <set>
 #include <vector>
 
 #include "avatar.h"
@@ -19,6 +21,8 @@
 #include "veh_appliance.h"
 #include "vehicle.h"
 #include "veh_type.h"
+#include "vpart_position.h"
+#include "vpart_range.h"
 
 static const damage_type_id damage_pure( "pure" );
 
@@ -781,3 +785,60 @@ TEST_CASE( "autopilot_tests", "[vehicle][autopilot]" )
     CHECK( test_autopilot_moving( vehicle_prototype_car, vpart_id::NULL_ID() ) == 0 );
     CHECK( test_autopilot_moving( vehicle_prototype_car, vpart_programmable_autopilot ) == 9 );
 }
+
+TEST_CASE( "parts_at_relative_cache_matches_parts", "[vehicle]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint vehicle_origin( 60, 60, 0 );
+    vehicle *veh_ptr = here.add_vehicle( vehicle_prototype_car, vehicle_origin, 0_degrees, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+
+    // include a point outside the bounding box of the vehicle
+    std::set<point> mounts = { point( 100, 100 ) };
+    for( const vpart_reference &vpr : veh.get_all_parts_with_fakes() ) {
+        mounts.insert( vpr.mount() );
+    }
+    for( const point &mount : mounts ) {
+        CAPTURE( mount );
+        for( const bool include_fake : { false, true } ) {
+            CAPTURE( include_fake );
+            std::vector<int> cached = veh.parts_at_relative( mount, true, include_fake );
+            std::vector<int> uncached = veh.parts_at_relative( mount, false, include_fake );
+            std::sort( cached.begin(), cached.end() );
+            std::sort( uncached.begin(), uncached.end() );
+            CHECK( cached == uncached );
+        }
+    }
+}
+
+// Benchmarks are skipped by default by using [.] tag
+TEST_CASE( "vehicle_part_lookup_benchmark", "[.][vehicle][benchmark]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint vehicle_origin( 60, 60, 0 );
+    vehicle *veh_ptr = here.add_vehicle( vehicle_prototype_car, vehicle_origin, 0_degrees, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+    std::vector<point> mounts;
+    for( const vpart_reference &vpr : veh.get_all_parts() ) {
+        mounts.push_back( vpr.mount() );
+    }
+
+    BENCHMARK( "parts_at_relative" ) {
+        size_t found = 0;
+        for( const point &mount : mounts ) {
+            found += veh.parts_at_relative( mount, true ).size();
+        }
+        return found;
+    };
+    BENCHMARK( "veh_at over the reality bubble" ) {
+        int found = 0;
+        for( const tripoint &p : here.points_on_zlevel( 0 ) ) {
+            found += here.veh_at( p ).has_value();
+        }
+        return found;
+    };
+}
@@ -178,6 +178,24 @@ TEST_CASE( "eternal_season", "[weather]" )
     }
 }
 
+TEST_CASE( "weather_timeline_shares_hourly_samples", "[weather]" )
+{
+    const weather_generator wgen;
+    const unsigned seed = seeds[0];
+    weather_timeline timeline;
+    const time_point hour = calendar::turn_zero + 100_days + 5_hours;
+    // all of the overmap terrain at 1,1 is sampled at its corner
+    const tripoint omt_origin( 24, 24, 0 );
+
+    const units::temperature temperature = timeline.temperature( wgen, seed, tripoint( 30, 40, 0 ),
+                                           hour + 20_minutes );
+    CHECK( temperature == wgen.get_weather_temperature( omt_origin, hour, seed ) );
+    CHECK( timeline.temperature( wgen, seed, tripoint( 47, 24, 0 ), hour + 59_minutes ) ==
+           temperature );
+    CHECK( timeline.temperature( wgen, seed, tripoint( 30, 40, 0 ), hour + 1_hours ) ==
+           wgen.get_weather_temperature( omt_origin, hour + 1_hours, seed ) );
+}
+
 TEST_CASE( "local_wind_chill_calculation", "[weather][wind_chill]" )
 {
     // `get_local_windchill` returns degrees F offset from current temperature,